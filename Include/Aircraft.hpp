@@ -6,17 +6,28 @@
 #include <vector>
 #include <memory>
 #include "../include/json.hpp"
+#include "Result.hpp"
+#include "Interner.hpp"
 
 // ===================================== Time functions ===================================== //
 using timeType = std::chrono::system_clock::time_point;
+// Format "YYYY-MM-DD HH:MM"; parse accepts that or a bare "YYYY-MM-DD" (midnight).
+// UTC epoch arithmetic only (no locale / TZ calls): thread-safe, and the buffer overloads never allocate.
+const std::size_t dateTimeLength = 16;
 const std::string formatDateTime(const timeType& tp); 
-timeType parseDate(const std::string& str);
+std::size_t formatDateTime(const timeType& tp, char* buffer);     // buffer: dateTimeLength + 1 bytes
+timeType parseDate(const std::string& str);                       // throws std::runtime_error if malformed
+bool tryParseDate(const char* text, std::size_t length, timeType& out);
+bool isDateOnly(const std::string& str);                          // a bare "YYYY-MM-DD", no time of day
+int daysFromCivil(int year, int month, int day);   // days since 1970-01-01 (proleptic Gregorian)
+void civilFromDays(long long days, int& year, int& month, int& day);
+int toUtcDay(const timeType& tp);                   // UTC calendar day of tp (airport days: localDayAt)
 
 // ===================================== Aircraft Class ===================================== //
 
 class Aircraft {
 private:
-    std::string model;
+    Symbol model;
     int capacity;
     bool available;
 
@@ -32,9 +43,11 @@ public:
  
     bool isMaintained() const;
     bool isAvailable() const;
+    const timeType& getLastMaintenance() const { return lastMaintenance; }
     void updateMaintenanceSchedule(const timeType& newLast, const timeType& newNext);
         
     const std::string& getModel() const;
+    Symbol getModelId() const { return model; }
     nlohmann::json getAircraftJson() const;
     void displayAircraftInfo() const;
     int getCapacity() const;
@@ -42,24 +55,33 @@ public:
 
 // ===================================== Aircrafts System Class ===================================== //
 
+struct SnapshotData;
+
 class AircraftsSystem {
 private:
     std::vector<std::shared_ptr<Aircraft>> aircrafts;
     std::fstream aircraftsFile;
     using timeType = std::chrono::system_clock::time_point;
 
-    int selectAircraft() const;
+    std::shared_ptr<Aircraft> selectAircraft() const;
+    void saveAircrafts() const;
 
 public:
-    AircraftsSystem();
-    ~AircraftsSystem();
+    explicit AircraftsSystem(const SnapshotData* tables = nullptr);
 
+    // -- Console menus (prompt, then call the API below) :
     void addAircraft();
     void removeAircraft();
     void displayAircrafts() const;
-    std::vector<std::shared_ptr<Aircraft>> getAircrafts() const { return aircrafts; }
-
     void logMaintenance();
+
+    // -- Headless API, no console I/O :
+    const std::vector<std::shared_ptr<Aircraft>>& getAircrafts() const { return aircrafts; }
+    std::shared_ptr<Aircraft> getAircraftByModel(const std::string& model) const;
+    std::shared_ptr<Aircraft> getAircraftByModel(Symbol model) const;
+    OpResult addAircraft(const std::string& model, int capacity);
+    OpResult removeAircraft(const std::string& model);
+    OpResult logMaintenance(const std::string& model, const timeType& last, const timeType& next);
 };
 
 // =====================================   Crew class   ===================================== //
@@ -69,7 +91,7 @@ class Crew {
 private:
     int crewID;
     std::string name;
-    std::string role; 
+    Symbol role;
     double totalFlightHours;
     std::vector<std::shared_ptr<Crew>> crewmembers;
     const double maxFlightHours = 5; //max no of hours per day
@@ -80,8 +102,12 @@ public:
     bool isCrewAvailable() const;
     void displayCrewInfo() const;
     void assignToFlight(int flightHours);
-    std::string getRole(){ return role; }
+    void restoreFlight(int flightHours);    // a saved assignment being loaded: counted, not re-checked
+    void releaseFlight(int flightHours);    // the flight is gone, its hours no longer count
+    const std::string& getRole() const { return role.str(); }
+    Symbol getRoleId() const { return role; }
     int getId() { return crewID;}
+    double getTotalFlightHours() const { return totalFlightHours; }
     std::vector<std::shared_ptr<Crew>> getCrewMembers() const { return crewmembers; }
 
 };
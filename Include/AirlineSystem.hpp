@@ -11,12 +11,15 @@
 #include "UserSystem.hpp"
 #include "Checkin.hpp"
 #include "Reports.hpp"
+#include "Bootstrap.hpp"
 
 class AirlineSystem {
 private:
+    SnapshotRefresh snapshotRefresh;     // first member, so it runs last: after every journal merged
+    std::unique_ptr<Bootstrap> boot;     // parsed tables and startup timings, only held while the systems below load
     UserSystem userSystem;
-    FlightSystem flightSystem;
     AircraftsSystem aircraftSystem;
+    FlightSystem flightSystem;
     ReservationSystem reservationSystem;
     CheckinSystem checkinSystem;
     
@@ -50,9 +53,12 @@ public:
     void agent_BookFlight();
     void agent_RemoveBooking();
     void agent_ModifyBooking();
+    void agent_GroupCheckIn();
+    void agent_PrintBoardingPasses();
 
 public:
     void userLoop();
+    void serve(int port, int workers);      // headless: booking server instead of the console menus
     
 };
 
@@ -0,0 +1,68 @@
+#ifndef BOARDINGPASS_HPP
+#define BOARDINGPASS_HPP
+
+#include <ostream>
+#include <string>
+#include <vector>
+#include "Aircraft.hpp"
+#include "Booking.hpp"
+
+class Flight;
+
+// ===================================== BoardingPassRenderer Class ===================================== //
+// Renders boarding passes into one growing buffer instead of streaming each line to std::cout.
+// The flight's fields (number, airports, boarding time) are formatted once by setFlight(); every
+// add() then only appends the passenger's name, seat and reservation id (in the printable format
+// the flight's box rows are rendered once too), so a whole manifest is
+// rendered with no per-pass allocation once reserve() has sized the buffer, and leaves the
+// process as a single write.
+//   text      : the console layout CheckinSystem has always printed
+//   json      : one object per line (JSON Lines), ready to stream to a print service
+//   printable : a fixed 40-column box per pass with a Code 39 barcode payload, passes separated by
+//               a form feed, so a plain line printer cuts one pass per page
+//
+//     BoardingPassRenderer renderer(PassFormat::printable);
+//     renderer.renderManifest(*flight, reservationSystem.getManifest(flightNumber));
+//     renderer.writeTo(file);
+
+enum class PassFormat {text, json, printable};
+
+class BoardingPassRenderer {
+private:
+    PassFormat format;
+    std::string buffer;
+    std::size_t passes = 0;
+
+    // -- Current flight, pre-formatted by setFlight
+    std::string flightNumber;
+    std::string origin;
+    std::string destination;
+    std::string boardingTime;
+    std::string printableRoute;         // the Flight / From / To box rows
+    std::string printableBoarding;      // the Boarding box row
+
+    void appendInt(int value);
+    void appendJsonString(const std::string& text);
+    std::size_t estimatedPassSize() const;
+
+public:
+    explicit BoardingPassRenderer(PassFormat format = PassFormat::text) : format(format) {}
+
+    void setFlight(int number, const std::string& from, const std::string& to, const timeType& departure);
+    void setFlight(const Flight& flight);
+    void reserve(std::size_t passCount);
+
+    void add(const std::string& passengerName, int seatNumber, int reservationId);
+    // Passes for the manifest's entries (checked-in passengers only, unless checkedInOnly is false); returns how many
+    std::size_t renderManifest(const Flight& flight, const std::vector<ManifestEntry>& manifest, bool checkedInOnly = true);
+
+    const std::string& output() const { return buffer; }
+    std::size_t size() const { return passes; }
+    void writeTo(std::ostream& out) const { out.write(buffer.data(), static_cast<std::streamsize>(buffer.size())); }
+    void clear();
+};
+
+const char* passFormatName(PassFormat format);
+const char* passFormatExtension(PassFormat format);    // "txt", "jsonl", "prn"
+
+#endif
@@ -0,0 +1,77 @@
+#ifndef BOOKING_HPP
+#define BOOKING_HPP
+
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// ===================================== Booking API types ===================================== //
+// Input and output of ReservationSystem::book(), the prompt-free booking entry point that
+// agent threads call concurrently.
+
+struct BookingRequest {
+    int passengerId = 0;
+    int flightNumber = 0;
+    int seatNumber = 0;             // 0 = first free seat
+    std::string method;
+    std::string details;
+    int amount = 0;
+};
+
+enum class BookingStatus {booked, unknownPassenger, unknownFlight, unknownReservation, invalidSeat, seatTaken, flightFull};
+
+struct BookingResult {
+    BookingStatus status = BookingStatus::booked;
+    int reservationId = 0;
+    int seatNumber = 0;
+
+    bool ok() const { return status == BookingStatus::booked; }
+};
+
+// One passenger on a flight, as listed by ReservationSystem::getManifest() (sorted by seat)
+struct ManifestEntry {
+    int seatNumber = 0;
+    int reservationId = 0;
+    int passengerId = 0;
+    std::string passengerName;
+    bool checkedIn = false;
+};
+
+// Outcome of a batch check-in (ReservationSystem::checkIn / checkInFlight), reservation ids by outcome
+struct CheckInResult {
+    std::vector<int> checkedIn;             // checked in by this call
+    std::vector<int> alreadyCheckedIn;
+    std::vector<int> notFound;
+};
+
+inline std::string bookingStatusToString(BookingStatus status){
+    switch (status) {
+        case BookingStatus::booked: return "booked";
+        case BookingStatus::unknownPassenger: return "passenger not found";
+        case BookingStatus::unknownFlight: return "flight not found";
+        case BookingStatus::unknownReservation: return "reservation not found";
+        case BookingStatus::invalidSeat: return "invalid seat number";
+        case BookingStatus::seatTaken: return "seat already taken";
+        default: return "flight is full";
+    }
+}
+
+// ===================================== StripedMutex Class ===================================== //
+// A fixed set of mutexes shared by many keys: a key always maps to the same stripe, so work
+// on one key is serialized while different keys rarely contend, without a mutex per entity.
+template <std::size_t Stripes>
+class StripedMutex {
+private:
+    struct alignas(64) Stripe { std::mutex m; };     // one cache line each, no false sharing
+    std::array<Stripe, Stripes> stripes;
+
+public:
+    std::mutex& forKey(int key) {
+        return stripes[std::hash<int>()(key) % Stripes].m;
+    }
+};
+
+#endif
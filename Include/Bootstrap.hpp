@@ -0,0 +1,63 @@
+#ifndef BOOTSTRAP_HPP
+#define BOOTSTRAP_HPP
+
+#include <chrono>
+#include <ostream>
+#include <string>
+#include <thread>
+#include <vector>
+#include "Snapshot.hpp"
+
+// ===================================== Bootstrap Class ===================================== //
+// Cold start in two phases.
+//   parse : every table is read into plain records at once, one task per table on a small pool
+//           of threads (from the binary snapshot when it is fresh, otherwise from the JSON files).
+//           From JSON, reservations are the exception: they are not held as records but streamed
+//           row by row during their link step (link() returns nullptr), keeping memory bounded.
+//   link  : the systems are built from those records one after another, in dependency order,
+//           which is where aircraft models, crew ids, passenger ids and flight numbers are
+//           resolved and the journals are replayed.
+// Each table's parse and each link step is timed; report() prints the breakdown.
+//
+//     Bootstrap boot;
+//     UserSystem users(boot.link("users"));          // link() closes the previous step, opens this one
+//     ...
+//     boot.finish();
+//     boot.report(std::cout);
+
+class Bootstrap {
+private:
+    using clock = std::chrono::steady_clock;
+    struct Step {
+        std::string name;
+        double ms;
+    };
+
+    SnapshotData tables;
+    std::string source;             // "snapshot" or "JSON"
+    std::vector<std::string> streamed;  // tables left to their system's own streaming loader
+    unsigned threadsUsed = 1;
+    double parseMs = 0;
+    std::vector<Step> parseSteps;
+    std::vector<Step> linkSteps;
+    clock::time_point linkStarted;
+    clock::time_point stepStarted;
+    bool linking = false;
+
+    void closeStep();
+
+public:
+    explicit Bootstrap(unsigned threads = std::thread::hardware_concurrency());   // runs the parse phase
+
+    Bootstrap(const Bootstrap&) = delete;
+    Bootstrap& operator=(const Bootstrap&) = delete;
+
+    const SnapshotData* link(const std::string& step);    // nullptr for a streamed table: the system loads it itself
+    void finish();
+    void report(std::ostream& out) const;
+
+    double parseMilliseconds() const { return parseMs; }
+    double linkMilliseconds() const;
+};
+
+#endif
@@ -4,7 +4,9 @@
 #include <iostream>
 #include <fstream>
 #include <string>
+#include <vector>
 
+#include "BoardingPass.hpp"
 #include "Reservation.hpp"
 #include "json.hpp"
 #include "Flight.hpp"
@@ -13,17 +15,26 @@
 class CheckinSystem {
 private:
     ReservationSystem& reservationSystem;
+    FlightSystem& flightSystem;
 public:
 
-    CheckinSystem(ReservationSystem& rs) : reservationSystem(rs) {}
+    CheckinSystem(ReservationSystem& rs, FlightSystem& fs) : reservationSystem(rs), flightSystem(fs) {}
     ~CheckinSystem();
 
     // Airport check-in process
     bool airportCheckIn(int reservationId);
 
+    // Group / whole-flight check-in: one pass over the reservations, one durable write
+    CheckInResult groupCheckIn(const std::vector<int>& reservationIds);
+    CheckInResult flightCheckIn(int flightNumber);
+
     // Generate boarding pass
     void generateBoardingPass(int reservationId) const;
 
+    // Every checked-in passenger's pass for a flight, rendered into one buffer and written to out at once;
+    // returns how many passes were written (0 if the flight does not exist)
+    std::size_t printBoardingPasses(int flightNumber, PassFormat format, std::ostream& out) const;
+
     // Display check-in status
     void displayCheckinStatus(int reservationId) const;
 };
@@ -0,0 +1,44 @@
+#ifndef FILTERKERNEL_HPP
+#define FILTERKERNEL_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+// ===================================== Filter kernels ===================================== //
+// The row test behind FlightTable::filter. A kernel fills a selection bitmap: bit r of words[w]
+// is set when row 64*w + r passes every predicate. Scalar, SSE4.1 and AVX2 versions share one
+// contract; filterKernel(bestFilterIsa()) is the widest one the running CPU supports (cpuid,
+// checked once). SIMD versions are only built by GCC / Clang on x86, elsewhere everything is scalar.
+
+struct FilterColumns {
+    const std::uint32_t* origins;       // airport Symbol ids
+    const std::uint32_t* destinations;
+    const std::int32_t* departureMinutes;
+    const std::int32_t* departureDays;
+    const std::uint8_t* statuses;       // FlightStatus, < 8
+    const std::int32_t* seatsFree;
+};
+
+struct FilterPredicate {
+    std::uint32_t origin = 0;           // compared only when !anyOrigin
+    std::uint32_t destination = 0;
+    bool anyOrigin = true;
+    bool anyDestination = true;
+    std::int32_t firstDay, lastDay;             // inclusive ranges
+    std::int32_t departsFrom, departsUntil;
+    std::uint8_t statusMask;                    // bit s set = status s wanted
+    std::int32_t minSeatsFree;
+};
+
+enum class FilterIsa {scalar, sse41, avx2};
+
+// rows need not be a multiple of 64; the unused high bits of the last word come back clear
+using FilterKernel = void (*)(const FilterColumns& columns, const FilterPredicate& predicate,
+                              std::size_t rows, std::uint64_t* words);
+
+bool filterIsaSupported(FilterIsa isa);
+FilterIsa bestFilterIsa();
+FilterKernel filterKernel(FilterIsa isa);       // nullptr when the CPU (or this build) lacks the ISA
+const char* filterIsaName(FilterIsa isa);
+
+#endif
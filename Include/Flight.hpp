@@ -1,6 +1,7 @@
 #ifndef FLIGHT_HPP
 #define FLIGHT_HPP
 #include <map>
+#include <cstdint>
 #include <iostream>
 #include <memory>
 #include <chrono>
@@ -8,25 +9,54 @@
 #include "Aircraft.hpp"
 #include "Reservation.hpp"
 #include "User.hpp"
+#include "Index.hpp"
+#include "RouteIndex.hpp"
+#include "FlightTable.hpp"
+#include "Journal.hpp"
+#include "Metrics.hpp"
+#include "Records.hpp"
+#include "Result.hpp"
 
 
 // class Passenger;
-
-enum class FlightStatus {scheduled, delayed, canceled, onTime};
+struct SnapshotData;
 
 // =====================================   SeatMap Class   ===================================== //
 
+// Seats are numbered 1..totalSeats and laid out row by row (seatsPerRow per row).
+// Availability is kept as a packed bitset (bit set = seat free) plus a running
+// free counter, so seatsCount() is O(1) and free-seat searches scan 64 seats per step.
 class SeatMap {
 private:
-    std::map<int, bool> seatsAvailability;
-    const int totalSeats; 
+    std::vector<std::uint64_t> freeBits;
+    const int totalSeats;
+    const int seatsPerRow;
+    int freeSeats;
+
+    bool isValidSeat(int num) const { return num >= 1 && num <= totalSeats; }
 
 public:
-    SeatMap(int seatNum);
+    SeatMap(int seatNum, int rowSize = 6);
     bool bookSeat(int num);
     bool unbookSeat(int num);
-    int seatsCount();
+    int seatsCount() const;
     void resetMap();
+
+    // -- Seat queries (return 0 when no free seat is found) :
+    bool isSeatFree(int num) const;
+    int getTotalSeats() const { return totalSeats; }
+    int firstFreeSeat(int from = 1) const;
+    int firstFreeInRange(int first, int last) const;
+    int freeSeatsInRange(int first, int last) const;
+
+    // -- Row / cabin aware queries (rows are numbered from 1, a cabin is a range of rows) :
+    int getSeatsPerRow() const { return seatsPerRow; }
+    int rowCount() const;
+    int rowOf(int num) const;
+    int firstFreeInRow(int row) const;
+    int freeSeatsInRow(int row) const;
+    int firstFreeInCabin(int firstRow, int lastRow) const;
+    int freeSeatsInCabin(int firstRow, int lastRow) const;
 };
 
 // =====================================   Flight Class   ===================================== //
@@ -34,8 +64,8 @@ public:
 class Flight {
 private:
     int flightNumber;
-    std::string origin;
-    std::string destination;
+    Symbol origin;              // interned airport names
+    Symbol destination;
     FlightStatus status;
 
     std::shared_ptr<Aircraft> aircraft;
@@ -44,6 +74,7 @@ private:
     using timeType = std::chrono::system_clock::time_point;
     timeType departureTime;
     timeType arrivalTime;
+    int departureDay;           // calendar day at the origin airport, fixed at construction
 
     std::vector<std::shared_ptr<Crew>> flightCrewMembers;
     SeatMap seats;
@@ -55,23 +86,48 @@ public:
 
     // -- Assign crew and aircraft to the flight : 
     void setCrew(std::shared_ptr<Crew> crew);
+    void restoreCrew(std::shared_ptr<Crew> crew);      // loading / replay: the assignment was checked when made
+    void releaseCrew();                                 // the flight is being removed: crew get its hours back
+    bool hasCrew(int crewId) const;
     void setAircraft(std::shared_ptr<Aircraft> craft);
     
-    bool isFlightFull();
-    int getFlightNo(){
+    bool isFlightFull() const;
+    int availableSeats() const { return seats.seatsCount(); }      // O(1), free counter
+    SeatMap& getSeatMap() { return seats; }
+    const SeatMap& getSeatMap() const { return seats; }
+    int getFlightNo() const {
         return flightNumber;
     }
-    std::string getOrigin(){
+    const std::string& getOrigin() const {
+        return origin.str();
+    }
+    const std::string& getDestination() const {
+        return destination.str();
+    }
+    Symbol getOriginId() const {
         return origin;
     }
-    std::string getDestination(){
+    Symbol getDestinationId() const {
         return destination;
     }
-    timeType getDepartureTime() {
+    timeType getDepartureTime() const {
         return departureTime;
     }
+    timeType getArrivalTime() const {
+        return arrivalTime;
+    }
+    std::shared_ptr<Aircraft> getAircraft() const {
+        return aircraft;
+    }
+    int getDepartureDay() const {
+        return departureDay;
+    }
+    FlightStatus getStatus() const {
+        return status;
+    }
 
-    bool isFlightMatch(const std::string& orgi, const std::string& desti, const timeType& time) const;
+    // `date` names a calendar day (e.g. parseDate("2025-10-03")), matched against the origin's local day
+    bool isFlightMatch(const std::string& orgi, const std::string& desti, const timeType& date) const;
     void changeStatus(FlightStatus newStatus);
     std::string getFlightDetails() const;
     nlohmann::json getFlightJson() const;
@@ -83,27 +139,64 @@ class FlightSystem{
 private: 
     std::vector<std::shared_ptr<Flight>> flights;
     std::vector<std::shared_ptr<Crew>> crewMembers;
-    std::vector<std::shared_ptr<Aircraft>> aircrafts;
+    const std::vector<std::shared_ptr<Aircraft>>& aircrafts;   // owned by AircraftsSystem
+    PrimaryIndex<int, Flight> flightsByNumber;
+    PrimaryIndex<int, Crew> crewById;
+    RouteIndex flightsByRoute;
+    FlightTable flightTable;
+    MetricsRegistry metrics;
+    Journal flightsJournal;
     std::fstream flightsfile;
     std::fstream crewfile;
     FlightStatus status;
     using timeType = std::chrono::system_clock::time_point;
 
+    std::shared_ptr<Flight> flightFromRecord(const FlightRecord& r) const;
+    void insertFlight(const std::shared_ptr<Flight>& flight);
+    bool eraseFlight(int flightNum);
+    void replayFlight(const FlightRecord& r);
+    OpResult checkCrew(const std::vector<int>& crewIds, std::vector<std::shared_ptr<Crew>>& members) const;
 
 public: 
-    FlightSystem();
+    explicit FlightSystem(const AircraftsSystem& aircraftSystem, const SnapshotData* tables = nullptr);
     ~FlightSystem();
+
+    // -- Console menus (prompt, then call the API below) :
     void displayFlights() const;
     int selectFlight();
     void addFlight();
     void removeFlight();
-    std::shared_ptr<Flight> getFlightByNumber(int flightNum) const;
-
     void selectCrew(std::shared_ptr<Flight> myflight);
     void updateFlightStatus(int num);
-
     std::shared_ptr<Flight> updateFlight();
     void searchFlight() const;
+
+    // -- Headless API, no console I/O :
+    std::shared_ptr<Flight> getFlightByNumber(int flightNum) const;
+    const std::vector<std::shared_ptr<Flight>>& getFlights() const { return flights; }
+    const std::vector<std::shared_ptr<Crew>>& getCrewMembers() const { return crewMembers; }
+    OpResult addFlight(const FlightRecord& flight);             // crewIDs, if any, are checked and assigned too
+    OpResult removeFlight(int flightNum);
+    OpResult updateFlightStatus(int flightNum, FlightStatus status);
+    OpResult assignCrew(int flightNum, const std::vector<int>& crewIds);
+    std::vector<std::shared_ptr<Crew>> getAvailablePilots() const;
+    int requiredPilots(const Flight& flight) const;
+
+    // -- Route / date queries served from the route index (days are day numbers of the origin's local date) :
+    std::vector<std::shared_ptr<Flight>> findFlights(const std::string& orig, const std::string& dest, int day) const;
+    std::vector<std::shared_ptr<Flight>> findFlightsInRange(const std::string& orig, const std::string& dest,
+                                                            int firstDay, int lastDay) const;
+    std::vector<std::shared_ptr<Flight>> findFlightsFrom(const std::string& orig, int firstDay, int lastDay) const;
+    std::vector<int> departuresPerDay(int firstDay, int lastDay) const;     // [i] = flights on firstDay + i
+    std::vector<int> departuresNextDays(const timeType& now, int days) const;   // [i] = flights i days after their origin's today
+
+    // -- Columnar copy for analytics scans (see FlightTable) :
+    const FlightTable& getFlightTable() const { return flightTable; }
+    void syncSeats(const Flight& flight);      // after the flight's seat map changed, under its lock stripe
+
+    // -- Live counters for reports; ReservationSystem reports its bookings here too (see MetricsRegistry) :
+    const MetricsRegistry& getMetrics() const { return metrics; }
+    MetricsRegistry& getMetrics() { return metrics; }
     
     // std::shared_ptr<Reservation> bookFlight(const std::shared_ptr<Passenger>& p,bool agent = false);
 };
@@ -0,0 +1,94 @@
+#ifndef FLIGHTTABLE_HPP
+#define FLIGHTTABLE_HPP
+
+#include <climits>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "FilterKernel.hpp"
+#include "Records.hpp"
+
+class Flight;
+
+// ===================================== FlightTable Class ===================================== //
+// Column-per-field copy of the fields analytics scans filter on, kept next to FlightSystem's
+// Flight objects (structure of arrays). A filter walks a few flat arrays of small integers
+// instead of chasing one shared_ptr per flight into strings, the seat map and the crew list.
+// Airports are stored as their interned symbol ids; a route is its (origin, destination) id
+// pair, kept as two columns so a filter compares ids instead of indexing a lookup table per row.
+// FlightSystem keeps rows in step with its flights; ReservationSystem refreshes the seat
+// column under the flight's lock stripe whenever a seat is booked or released.
+// Every scan starts from filter(), which runs the widest SIMD filter kernel the CPU supports
+// (see FilterKernel.hpp) over the columns and returns one bit per row.
+
+constexpr std::uint8_t anyStatus = 0xFF;
+
+inline std::uint8_t statusBit(FlightStatus status) {
+    return static_cast<std::uint8_t>(1u << static_cast<unsigned>(status));
+}
+
+struct FlightQuery {
+    std::string origin;                         // empty = any airport
+    std::string destination;                    // empty = any airport
+    int firstDay = INT_MIN;                     // departure day at the origin (Flight::getDepartureDay)
+    int lastDay = INT_MAX;
+    std::int32_t departsFrom = INT32_MIN;       // departure instant, minutes since the epoch (UTC)
+    std::int32_t departsUntil = INT32_MAX;
+    std::uint8_t statuses = anyStatus;          // statusBit(a) | statusBit(b) ...
+    int minSeatsFree = 0;
+};
+
+// ------ One bit per table row, set when the row matched (rows as of the filter() call) ------ //
+class SelectionBitmap {
+private:
+    std::vector<std::uint64_t> words;
+    std::size_t rows = 0;
+    friend class FlightTable;
+
+public:
+    std::size_t size() const { return rows; }
+    bool test(std::size_t row) const { return (words[row / 64] >> (row % 64)) & 1; }
+    std::size_t count() const;
+    const std::vector<std::uint64_t>& bits() const { return words; }
+};
+
+class FlightTable {
+private:
+    // -- Columns, one row per flight. Row order is arbitrary: removal moves the last row into the gap
+    std::vector<std::int32_t> flightNumbers;
+    std::vector<std::uint32_t> origins;         // airport Symbol ids
+    std::vector<std::uint32_t> destinations;
+    std::vector<std::int32_t> departureMinutes; // minutes since 1970-01-01 00:00 UTC
+    std::vector<std::int32_t> departureDays;    // local calendar day at the origin
+    std::vector<std::uint8_t> statuses;         // FlightStatus
+    std::vector<std::int32_t> seatsFree;
+    std::vector<std::int32_t> seatsTotal;
+    std::unordered_map<int, std::size_t> rowsByFlight;
+
+public:
+    // -- Row maintenance (FlightSystem / ReservationSystem) :
+    void insert(const Flight& flight);
+    bool erase(int flightNumber);
+    void setStatus(int flightNumber, FlightStatus status);
+    void setSeatsFree(int flightNumber, int seats);
+    void clear();
+
+    // -- Scans :
+    SelectionBitmap filter(const FlightQuery& query) const;
+    SelectionBitmap filter(const FlightQuery& query, FilterIsa isa) const;   // a given kernel, for benchmarks
+    std::size_t count(const FlightQuery& query) const;
+    std::vector<int> select(const FlightQuery& query) const;       // matching flight numbers, row order
+    long long seatsFreeWhere(const FlightQuery& query) const;
+    std::vector<int> departuresPerDay(int firstDay, int lastDay) const;   // [i] = flights on firstDay + i
+
+    // -- "The next n days", each row's days counted from today at its own origin airport :
+    SelectionBitmap filterNextDays(const FlightQuery& query, const timeType& now, int days) const;  // query's day range is replaced
+    std::vector<int> departuresNextDays(const timeType& now, int days) const;   // [i] = flights leaving i days after their origin's today
+    long long seatsFreeIn(const SelectionBitmap& selection) const;
+
+    int flightNumberAt(std::size_t row) const { return flightNumbers[row]; }
+    std::size_t size() const { return flightNumbers.size(); }
+};
+
+#endif
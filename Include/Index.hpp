@@ -0,0 +1,89 @@
+#ifndef INDEX_HPP
+#define INDEX_HPP
+
+#include <memory>
+#include <unordered_map>
+#include <utility>
+
+// ===================================== PrimaryIndex Class ===================================== //
+// Unique key -> entity hash index kept next to a system's entity vector.
+// The owning system must call insert/erase/rekey on every add, remove and key update
+// so lookups stay O(1) and consistent with the vector.
+
+template <typename Key, typename T>
+class PrimaryIndex {
+private:
+    std::unordered_map<Key, std::shared_ptr<T>> entries;
+
+public:
+    // Returns false (and keeps the old entry) if the key is already taken
+    bool insert(const Key& key, const std::shared_ptr<T>& value) {
+        return entries.emplace(key, value).second;
+    }
+
+    bool erase(const Key& key) {
+        return entries.erase(key) > 0;
+    }
+
+    // Move an entry to a new key, fails if the new key is already taken
+    bool rekey(const Key& oldKey, const Key& newKey) {
+        if (oldKey == newKey) return true;
+        auto it = entries.find(oldKey);
+        if (it == entries.end() || entries.count(newKey)) return false;
+        auto value = std::move(it->second);
+        entries.erase(it);
+        entries.emplace(newKey, std::move(value));
+        return true;
+    }
+
+    std::shared_ptr<T> find(const Key& key) const {
+        auto it = entries.find(key);
+        return (it != entries.end()) ? it->second : nullptr;
+    }
+
+    bool contains(const Key& key) const { return entries.count(key) > 0; }
+    std::size_t size() const { return entries.size(); }
+    void reserve(std::size_t n) { entries.reserve(n); }
+    void clear() { entries.clear(); }
+};
+
+// ===================================== SecondaryIndex Class ===================================== //
+// Non-unique key -> values index (e.g. passenger id -> that passenger's reservations).
+// Like PrimaryIndex, the owning system must insert/erase on every add and remove; a lookup
+// then costs O(values under the key) instead of a scan over every entity.
+
+template <typename Key, typename Value>
+class SecondaryIndex {
+private:
+    std::unordered_multimap<Key, Value> entries;
+
+public:
+    void insert(const Key& key, const Value& value) {
+        entries.emplace(key, value);
+    }
+
+    // Removes one (key, value) pair, false if it was not there
+    bool erase(const Key& key, const Value& value) {
+        auto range = entries.equal_range(key);
+        for (auto it = range.first; it != range.second; ++it) {
+            if (it->second == value) {
+                entries.erase(it);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    template <typename Fn>
+    void forEach(const Key& key, Fn&& fn) const {
+        auto range = entries.equal_range(key);
+        for (auto it = range.first; it != range.second; ++it) fn(it->second);
+    }
+
+    std::size_t count(const Key& key) const { return entries.count(key); }
+    std::size_t size() const { return entries.size(); }
+    void reserve(std::size_t n) { entries.reserve(n); }
+    void clear() { entries.clear(); }
+};
+
+#endif
@@ -0,0 +1,72 @@
+#ifndef INTERNER_HPP
+#define INTERNER_HPP
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <ostream>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+// ===================================== Symbol Class ===================================== //
+// A small repeated string (airport, aircraft model, crew role, payment method) stored once in
+// the process-wide StringInterner and referred to by a 32-bit id. Equal texts get equal ids, so
+// comparing two symbols is an integer compare. Symbol() is the empty string.
+
+class Symbol {
+private:
+    std::uint32_t value = 0;
+
+public:
+    Symbol() = default;
+    explicit Symbol(std::uint32_t id) : value(id) {}
+
+    std::uint32_t id() const { return value; }
+    bool empty() const { return value == 0; }
+    const std::string& str() const;
+
+    bool operator==(Symbol other) const { return value == other.value; }
+    bool operator!=(Symbol other) const { return value != other.value; }
+    bool operator<(Symbol other) const { return value < other.value; }     // id order, not text order
+};
+
+std::ostream& operator<<(std::ostream& out, Symbol symbol);
+
+// ===================================== StringInterner Class ===================================== //
+// Texts live in fixed chunks that never move, so text() is lock-free; intern() takes the write
+// lock only for a text it has not seen. Texts are never removed: intern values that repeat, and
+// use find() for lookups driven by user input so a query cannot grow the table.
+
+class StringInterner {
+private:
+    static constexpr std::uint32_t chunkBits = 10;
+    static constexpr std::uint32_t chunkSize = 1u << chunkBits;
+    static constexpr std::uint32_t maxChunks = 4096;               // 4M distinct texts
+
+    std::array<std::atomic<std::string*>, maxChunks> chunks{};
+    std::atomic<std::uint32_t> count{0};
+    mutable std::shared_mutex mutex;
+    std::unordered_map<std::string_view, std::uint32_t> ids;      // views into the chunks
+
+public:
+    StringInterner();
+    ~StringInterner();
+
+    StringInterner(const StringInterner&) = delete;
+    StringInterner& operator=(const StringInterner&) = delete;
+
+    Symbol intern(std::string_view text);
+    std::optional<Symbol> find(std::string_view text) const;      // nullopt if never interned
+    const std::string& text(Symbol symbol) const;
+    std::size_t size() const { return count.load(std::memory_order_acquire); }
+};
+
+StringInterner& strings();      // the process-wide table
+
+inline Symbol intern(std::string_view text) { return strings().intern(text); }
+
+#endif
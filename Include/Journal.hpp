@@ -0,0 +1,80 @@
+#ifndef JOURNAL_HPP
+#define JOURNAL_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include "json.hpp"
+#include "Persistence.hpp"
+
+// ===================================== Journal Class ===================================== //
+// Append-only write-ahead log for one JSON snapshot file (an array of rows with a unique key field).
+//
+//  - Mutations append one small delta record (a JSON line) to "<snapshot>.wal"
+//    instead of rewriting the whole snapshot. put/remove/patch return once the record
+//    is fsynced; concurrent callers share fsyncs (group commit), and a Batch lets one
+//    caller group several records behind a single fsync.
+//  - Every `checkpointEvery` records the log is sealed ("<snapshot>.wal.old") and merged
+//    into the snapshot by a background thread (written atomically), then the sealed log is deleted.
+//  - On startup the owning system loads the snapshot as before and calls replay()
+//    to re-apply the sealed and active logs; a leftover sealed log is merged at the next
+//    checkpoint (at the latest on shutdown). Records are idempotent (put / delete / patch
+//    by key), so replaying a log that was already partly merged is harmless.
+
+enum class JournalOp {put, remove, patch};
+
+class Journal {
+public:
+    using ApplyFn = std::function<void(JournalOp op, const nlohmann::json& key, const nlohmann::json& data)>;
+
+    // Several records committed with one fsync when the batch ends (or commit() is called)
+    class Batch {
+    private:
+        Journal& journal;
+        std::uint64_t lastSeq = 0;
+    public:
+        explicit Batch(Journal& j) : journal(j) {}
+        ~Batch();
+        void put(const nlohmann::json& row);
+        void remove(const nlohmann::json& key);
+        void patch(const nlohmann::json& key, const nlohmann::json& fields);
+        void commit();
+    };
+
+    Journal(const std::string& snapshot, const std::string& keyField, std::size_t checkpointEvery = 1000);
+    ~Journal();
+
+    Journal(const Journal&) = delete;
+    Journal& operator=(const Journal&) = delete;
+
+    void put(const nlohmann::json& row);                                  // insert or replace a whole row
+    void remove(const nlohmann::json& key);                               // delete a row
+    void patch(const nlohmann::json& key, const nlohmann::json& fields);  // overwrite some fields of a row
+
+    void replay(const ApplyFn& apply) const;
+    void checkpoint();
+
+private:
+    std::string snapshotPath;
+    std::string logPath;
+    std::string sealedPath;
+    std::string keyField;
+    std::size_t checkpointEvery;
+    std::size_t pendingRecords = 0;
+
+    std::mutex journalMutex;                // guards pendingRecords, log rotation and the merge thread
+    DurableLog log;
+    std::thread checkpointer;
+    std::atomic<bool> merging{false};
+
+    std::uint64_t append(const nlohmann::json& record);
+    void commit(std::uint64_t seq);
+    void startMerge();
+    static void replayFile(const std::string& path, const ApplyFn& apply);
+    static void mergeIntoSnapshot(const std::string& snapshot, const std::string& sealed, const std::string& keyField);
+};
+
+#endif
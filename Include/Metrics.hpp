@@ -0,0 +1,79 @@
+#ifndef METRICS_HPP
+#define METRICS_HPP
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+#include "Interner.hpp"
+#include "Records.hpp"
+
+class Flight;
+
+// ===================================== MetricsRegistry Class ===================================== //
+// Live operational counters, updated by the systems as they change instead of being recomputed
+// from the JSON files. FlightSystem reports flights added, removed and re-statused;
+// ReservationSystem reports reservations added and removed. Loading and journal replay go
+// through the same paths, so the counters are right from startup on.
+// Totals are atomics, so reading one is O(1) and takes no lock. Per-flight and per-route
+// counters live in hash maps behind one mutex, which is only held for a single increment.
+// A flight's reservations stay counted after the flight is removed, but they no longer
+// count toward the load factor.
+
+struct FlightMetrics {
+    int flightNumber = 0;
+    int seats = 0;                      // capacity while the flight is listed, 0 after it is removed
+    int reservations = 0;
+    long long revenue = 0;
+    bool listed = false;
+
+    double loadFactor() const { return seats > 0 ? static_cast<double>(reservations) / seats : 0.0; }
+};
+
+struct RouteMetrics {
+    Symbol origin;
+    Symbol destination;
+    int reservations = 0;
+    long long revenue = 0;
+};
+
+class MetricsRegistry {
+private:
+    static constexpr int statusSlots = 8;      // every status a statusBit mask can name
+
+    std::array<std::atomic<long>, statusSlots> flightsByStatus{};
+    std::atomic<long> flights{0};
+    std::atomic<long> seats{0};                 // capacity of the listed flights
+    std::atomic<long> seatsBooked{0};           // reservations on the listed flights
+    std::atomic<long> reservations{0};
+    std::atomic<long long> revenue{0};
+
+    mutable std::mutex mutex;
+    std::unordered_map<int, FlightMetrics> byFlight;
+    std::unordered_map<std::uint64_t, RouteMetrics> byRoute;    // origin id << 32 | destination id
+
+public:
+    // -- Writers (FlightSystem / ReservationSystem, on every mutation) :
+    void flightAdded(int flightNumber, FlightStatus status, int seatCount);
+    void flightRemoved(int flightNumber, FlightStatus status);
+    void flightStatusChanged(FlightStatus from, FlightStatus to);
+    void reservationAdded(const Flight* flight, int amount);       // flight may be null (unknown flight)
+    void reservationRemoved(const Flight* flight, int amount);
+
+    // -- Readers, O(1) :
+    long totalFlights() const { return flights.load(std::memory_order_relaxed); }
+    long flightsWithStatus(FlightStatus status) const;
+    long totalSeats() const { return seats.load(std::memory_order_relaxed); }
+    long totalReservations() const { return reservations.load(std::memory_order_relaxed); }
+    long long totalRevenue() const { return revenue.load(std::memory_order_relaxed); }
+    double loadFactor() const;                  // reservations on listed flights / their seats
+    FlightMetrics flight(int flightNumber) const;
+
+    // -- O(routes) / O(flights) :
+    std::vector<RouteMetrics> revenueByRoute() const;              // highest revenue first
+    std::vector<FlightMetrics> fullestFlights(std::size_t count) const;    // listed flights, highest load factor first
+};
+
+#endif
@@ -0,0 +1,125 @@
+#ifndef OBJECTPOOL_HPP
+#define OBJECTPOOL_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <utility>
+#include <vector>
+
+// ===================================== PoolHandle ===================================== //
+// Stable reference to an object in an ObjectPool: slot index + the slot's generation.
+// A handle to a destroyed object stays detectable (get() returns nullptr) even after
+// its slot is reused, because reuse bumps the generation.
+
+struct PoolHandle {
+    static constexpr std::uint32_t invalidIndex = 0xFFFFFFFFu;
+
+    std::uint32_t index = invalidIndex;
+    std::uint32_t generation = 0;
+
+    explicit operator bool() const { return index != invalidIndex; }
+    bool operator==(const PoolHandle& other) const { return index == other.index && generation == other.generation; }
+    bool operator!=(const PoolHandle& other) const { return !(*this == other); }
+};
+
+// ===================================== ObjectPool Class ===================================== //
+// Owns objects of one type in fixed-size chunks of slots, so a bulk load costs one allocation
+// per ChunkSize objects instead of one per object, objects never move (pointers stay valid
+// until destroy), and freed slots are reused through a free list.
+// Not thread-safe: the owning system guards it with its own lock.
+
+template <typename T, std::size_t ChunkSize = 4096>
+class ObjectPool {
+private:
+    struct Slot {
+        alignas(T) unsigned char storage[sizeof(T)];
+        std::uint32_t generation = 0;       // odd while the slot holds a live object
+        std::uint32_t nextFree = PoolHandle::invalidIndex;
+
+        T* object() { return std::launder(reinterpret_cast<T*>(storage)); }
+        bool live() const { return (generation & 1u) != 0; }
+    };
+
+    std::vector<std::unique_ptr<Slot[]>> chunks;
+    std::uint32_t usedSlots = 0;                        // slots handed out at least once
+    std::uint32_t freeHead = PoolHandle::invalidIndex;
+    std::size_t liveCount = 0;
+
+    Slot& slotAt(std::uint32_t index) const { return chunks[index / ChunkSize][index % ChunkSize]; }
+
+public:
+    ObjectPool() = default;
+    ~ObjectPool() { clear(); }
+
+    ObjectPool(const ObjectPool&) = delete;
+    ObjectPool& operator=(const ObjectPool&) = delete;
+
+    // -- Room for n objects in total, allocated now (one sweep before a bulk load)
+    void reserve(std::size_t n) {
+        chunks.reserve((n + ChunkSize - 1) / ChunkSize);
+        while (chunks.size() * ChunkSize < n) chunks.emplace_back(new Slot[ChunkSize]);
+    }
+
+    template <typename... Args>
+    PoolHandle create(Args&&... args) {
+        std::uint32_t index = freeHead;
+        bool reused = index != PoolHandle::invalidIndex;
+        if (!reused) {
+            index = usedSlots;
+            if (index / ChunkSize == chunks.size()) chunks.emplace_back(new Slot[ChunkSize]);
+        }
+        Slot& slot = slotAt(index);
+        ::new (static_cast<void*>(slot.storage)) T(std::forward<Args>(args)...);  // may throw: slot untouched
+        if (reused) freeHead = slot.nextFree;
+        else ++usedSlots;
+        ++slot.generation;
+        ++liveCount;
+        return {index, slot.generation};
+    }
+
+    // nullptr for an invalid, stale or destroyed handle
+    T* get(PoolHandle handle) const {
+        if (handle.index >= usedSlots) return nullptr;
+        Slot& slot = slotAt(handle.index);
+        return slot.generation == handle.generation && slot.live() ? slot.object() : nullptr;
+    }
+
+    bool destroy(PoolHandle handle) {
+        if (!get(handle)) return false;
+        Slot& slot = slotAt(handle.index);
+        slot.object()->~T();
+        ++slot.generation;
+        slot.nextFree = freeHead;
+        freeHead = handle.index;
+        --liveCount;
+        return true;
+    }
+
+    // -- Every live object, in slot order
+    template <typename Fn>
+    void forEach(Fn&& fn) const {
+        for (std::uint32_t i = 0; i < usedSlots; i++) {
+            Slot& slot = slotAt(i);
+            if (slot.live()) fn(*slot.object());
+        }
+    }
+
+    void clear() {
+        for (std::uint32_t i = 0; i < usedSlots; i++) {
+            Slot& slot = slotAt(i);
+            if (slot.live()) slot.object()->~T();
+        }
+        chunks.clear();
+        usedSlots = 0;
+        freeHead = PoolHandle::invalidIndex;
+        liveCount = 0;
+    }
+
+    std::size_t size() const { return liveCount; }
+    std::size_t capacity() const { return chunks.size() * ChunkSize; }
+    std::size_t bytesReserved() const { return chunks.size() * ChunkSize * sizeof(Slot); }
+};
+
+#endif
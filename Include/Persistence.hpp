@@ -0,0 +1,51 @@
+#ifndef PERSISTENCE_HPP
+#define PERSISTENCE_HPP
+
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <string>
+
+// ===================================== Durable file helpers ===================================== //
+// Every file the system rewrites goes through writeFileAtomic: the data is written to
+// "<path>.tmp", fsynced, renamed over the target and the directory is fsynced, so after
+// a crash the file holds either the old or the new contents, never a truncated mix.
+
+void writeFileAtomic(const std::string& path, const std::string& contents);
+void renameFileDurable(const std::string& from, const std::string& to);
+void removeFileDurable(const std::string& path);
+void syncParentDirectory(const std::string& path);
+
+// ===================================== DurableLog Class ===================================== //
+// Append-only file with group commit. append() only writes; waitDurable(seq) returns once
+// record `seq` is on disk. The first waiter becomes the leader and fsyncs everything
+// appended so far, so concurrent (or batched) mutations share a single fsync.
+
+class DurableLog {
+private:
+    std::string path;
+    int fd = -1;
+    std::mutex logMutex;
+    std::condition_variable synced;
+    std::uint64_t appendedSeq = 0;
+    std::uint64_t durableSeq = 0;
+    bool syncing = false;
+
+    void open();
+    void close();
+
+public:
+    explicit DurableLog(const std::string& path);
+    ~DurableLog();
+
+    DurableLog(const DurableLog&) = delete;
+    DurableLog& operator=(const DurableLog&) = delete;
+
+    std::uint64_t append(const std::string& data);
+    void waitDurable(std::uint64_t seq);
+
+    // Sync, then move the current file to `sealedPath` and start a new empty one
+    void rotate(const std::string& sealedPath);
+};
+
+#endif
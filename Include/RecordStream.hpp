@@ -0,0 +1,33 @@
+#ifndef RECORDSTREAM_HPP
+#define RECORDSTREAM_HPP
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include "Records.hpp"
+
+// ===================================== Streaming JSON loaders ===================================== //
+// Read a JSON array file row by row through nlohmann's SAX interface. Each row is built
+// straight into its record from the parse events and handed to `sink`; no DOM is created,
+// so memory stays bounded by one row whatever the file size. Unknown fields are skipped,
+// missing required fields throw std::runtime_error naming the row.
+
+template <typename Record>
+using RecordSink = std::function<void(Record&& record)>;
+
+// Each returns the number of rows read
+std::size_t streamAircraftRecords(const std::string& path, const RecordSink<AircraftRecord>& sink,
+                                  const JsonProgressFn& progress = nullptr);
+std::size_t streamCrewRecords(const std::string& path, const RecordSink<CrewRecord>& sink,
+                              const JsonProgressFn& progress = nullptr);
+std::size_t streamUserRecords(const std::string& path, const RecordSink<UserRecord>& sink,
+                              const JsonProgressFn& progress = nullptr);
+std::size_t streamFlightRecords(const std::string& path, const RecordSink<FlightRecord>& sink,
+                                const JsonProgressFn& progress = nullptr);
+std::size_t streamReservationRecords(const std::string& path, const RecordSink<ReservationRecord>& sink,
+                                     const JsonProgressFn& progress = nullptr);
+
+// Progress printer for the console: silent for small files, otherwise "Loading <label>: NN%"
+JsonProgressFn consoleProgress(const std::string& label);
+
+#endif
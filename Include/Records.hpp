@@ -0,0 +1,110 @@
+#ifndef RECORDS_HPP
+#define RECORDS_HPP
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+#include "Aircraft.hpp"
+#include "User.hpp"
+#include "json.hpp"
+
+// ===================================== Flight status ===================================== //
+enum class FlightStatus {scheduled, delayed, canceled, onTime};
+
+inline std::string flightStatusToString(FlightStatus status){
+    switch (status) {
+        case FlightStatus::scheduled: return "scheduled";
+        case FlightStatus::delayed: return "delayed";
+        case FlightStatus::canceled: return "canceled";
+        default: return "onTime";
+    }
+}
+inline FlightStatus stringToFlightStatus(const std::string& str){
+    if (str == "scheduled") return FlightStatus::scheduled;
+    if (str == "delayed") return FlightStatus::delayed;
+    if (str == "canceled") return FlightStatus::canceled;
+    if (str == "onTime") return FlightStatus::onTime;
+    throw std::runtime_error("Invalid flight status in JSON");
+}
+
+// ===================================== Plain row records ===================================== //
+// One struct per database row, independent of where it was read from (JSON DOM, binary
+// snapshot, journal). Systems build their objects from records, so every loader only has
+// to produce records and the linking code (aircraft model, crew ids, passenger, flight)
+// lives in one place.
+
+struct AircraftRecord {
+    std::string model;
+    int capacity = 0;
+    bool available = true;
+    timeType lastMaintenance;
+    timeType nextMaintenance;
+};
+
+struct CrewRecord {
+    int crewID = 0;
+    std::string name;
+    std::string role;
+    double totalFlightHours = 0.0;
+};
+
+struct UserRecord {
+    int id = 0;
+    std::string name;
+    std::string email;
+    std::string password;
+    Role role = Role::none;
+};
+
+struct FlightRecord {
+    int flightNumber = 0;
+    std::string origin;
+    std::string destination;
+    std::string aircraftModel;
+    FlightStatus status = FlightStatus::scheduled;
+    timeType departureTime;
+    timeType arrivalTime;
+    std::vector<int> crewIDs;
+    // Set while a time is still a bare date read as UTC midnight; anchorBareDates moves it to the
+    // start of that day at the airport (origin for departure, destination for arrival)
+    bool departureDateOnly = false;
+    bool arrivalDateOnly = false;
+};
+
+struct ReservationRecord {
+    int reservationId = 0;
+    int passengerId = 0;
+    int flightNumber = 0;
+    int seatNumber = 0;
+    std::string checkIn;
+    std::string method;
+    std::string details;
+    int amount = 0;
+};
+
+// --- JSON row <-> record (same field names as the files in Database/) :
+AircraftRecord aircraftRecordFromJson(const nlohmann::json& item);
+CrewRecord crewRecordFromJson(const nlohmann::json& item);
+UserRecord userRecordFromJson(const nlohmann::json& item);
+FlightRecord flightRecordFromJson(const nlohmann::json& item);
+ReservationRecord reservationRecordFromJson(const nlohmann::json& item);
+void anchorBareDates(FlightRecord& r);
+
+nlohmann::json toJson(const AircraftRecord& r);
+nlohmann::json toJson(const CrewRecord& r);
+nlohmann::json toJson(const UserRecord& r);
+nlohmann::json toJson(const FlightRecord& r);
+nlohmann::json toJson(const ReservationRecord& r);
+
+// --- Whole-file loaders (JSON array files, streamed, see RecordStream.hpp). They hold every row;
+//     a system loading one table for itself should stream it instead :
+using JsonProgressFn = std::function<void(std::uint64_t bytesRead, std::uint64_t totalBytes)>;
+
+std::vector<AircraftRecord> loadAircraftRecords(const std::string& path, const JsonProgressFn& progress = nullptr);
+std::vector<CrewRecord> loadCrewRecords(const std::string& path, const JsonProgressFn& progress = nullptr);
+std::vector<UserRecord> loadUserRecords(const std::string& path, const JsonProgressFn& progress = nullptr);
+std::vector<FlightRecord> loadFlightRecords(const std::string& path, const JsonProgressFn& progress = nullptr);
+std::vector<ReservationRecord> loadReservationRecords(const std::string& path, const JsonProgressFn& progress = nullptr);
+
+#endif
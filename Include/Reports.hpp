@@ -3,11 +3,14 @@
 
 #include <string>
 
+class FlightSystem;
+class ReservationSystem;
+
 class Reports {
 public:
-    void generateOperationalReport() const;
+    void generateOperationalReport(const FlightSystem& flightSystem) const;
     void generateMaintenanceReport() const;
-    void generateUserActivityReport() const;
+    void generateUserActivityReport(const FlightSystem& flightSystem, const ReservationSystem& reservationSystem) const;
 };
 
 #endif
\ No newline at end of file
@@ -9,11 +9,22 @@
 #include <string>
 #include <utility>
 #include "json.hpp"
+#include "ObjectPool.hpp"
+#include "Index.hpp"
+#include "Interner.hpp"
+#include "Journal.hpp"
+#include "Booking.hpp"
+#include <atomic>
+#include <map>
+#include <unordered_map>
+#include <shared_mutex>
 
 class UserSystem;
 class FlightSystem;
 class Passenger;
 class Flight;
+struct SnapshotData;
+struct ReservationRecord;
 
 // ============================ Payment Class ====================== //
 class Payment{
@@ -21,19 +32,19 @@ friend class Reservation;
 friend class ReservationSystem;
 
 private:
-    std::string method;
+    Symbol method;              // interned: a handful of distinct values across all reservations
     std::string details;
     int amount;
 
 public: 
-    Payment(std::string& m, std::string& d, int a)
-    : method(m), details(d), amount(a) {}
+    Payment(const std::string& m, const std::string& d, int a)
+    : method(intern(m)), details(d), amount(a) {}
 
 };
 
 // ============================ Reservation Class ====================== //
 class Reservation{
-    // friend class ReservationSystem;
+    friend class ReservationSystem;
     friend class CheckinSystem;
 private:
     int reservationId; 
@@ -42,15 +53,16 @@ private:
     std::shared_ptr<Flight> flight;
     Payment payment;
     int seatNum;
+    bool checkedIn = false;     // written by ReservationSystem under its exclusive lock
 
 public:
-    static int reservationCount;
+    static std::atomic<int> reservationCount;
     std::shared_ptr<Passenger> getPassenger() const { return passenger; }
     std::shared_ptr<Flight> getFlight() const { return flight; }
 
 
-    Reservation(int reservationId, const std::shared_ptr<Passenger>& p, const std::shared_ptr<Flight>& f,
-        int s, std::string& method, std::string& details, int amount);
+    Reservation(int reservationId, std::shared_ptr<Passenger> p, std::shared_ptr<Flight> f,
+        int s, const std::string& method, const std::string& details, int amount);
 
     ~Reservation();
 
@@ -58,6 +70,7 @@ public:
     void confirmReservation() const;
     void cancelReservation();
     void displayReservation() const;
+    nlohmann::json getReservationJson() const;
 
     // -------- Getters and Setters --------- //
     int getReservationId(){
@@ -66,12 +79,18 @@ public:
     int getSeatNo() const {
         return seatNum;
     }
+    void setSeatNo(int s){
+        seatNum = s;
+    }
     void setReservationId(int r){
         this->reservationId = r;
     }
     int getCost() const{
         return payment.amount;
     }
+    bool isCheckedIn() const {
+        return checkedIn;
+    }
 };
 
 // ============================ Reservation System class ====================== //
@@ -79,29 +98,64 @@ class ReservationSystem{
     private: 
     std::vector<std::shared_ptr<Passenger>> passengers;
     std::vector<std::shared_ptr<Flight>> flights;
-    std::vector<std::shared_ptr<Reservation>> reservations;
+    // -- Reservations live in a pool (chunked slots, no per-object allocation); the indexes hold handles
+    ObjectPool<Reservation> reservations;
+    std::unordered_map<int, PoolHandle> reservationsById;
+    SecondaryIndex<int, PoolHandle> reservationsByPassenger;    // reservations with no passenger are not in it
+    SecondaryIndex<int, PoolHandle> reservationsByFlight;       // flight number -> its passengers (manifest)
+    Journal reservationsJournal;
+
+    // -- Concurrency: the reservation list/index is shared, seat maps are locked per flight stripe
+    mutable std::shared_mutex reservationsMutex;
+    mutable StripedMutex<64> flightLocks;
+    std::atomic<int> nextReservationId{1};
+    std::map<std::pair<int, int>, int> sharedSeats;    // (flight, seat) -> extra holders found in the file
+    std::atomic<int> sharedSeatCount{0};
+    std::mutex sharedSeatsMutex;
 
     std::fstream reservationsFile;
 
     FlightSystem &flightSystem;
     UserSystem &userSystem;
 
+    Reservation* addReservation(const ReservationRecord& r);
+    Reservation* addReservation(int resId, std::shared_ptr<Passenger> passenger, std::shared_ptr<Flight> flight,
+                                int seat, const std::string& method, const std::string& details, int amount);
+    Reservation* lookupReservation(int resId) const;        // caller holds reservationsMutex
+    void destroyReservation(std::unordered_map<int, PoolHandle>::iterator entry);   // caller holds it exclusively
+    void rebuildSeatMaps();
+    void releaseSeat(Flight& flight, int seat);
+    void journalCheckIns(const std::vector<int>& resIds);
+
     public:
 
-    ReservationSystem(FlightSystem& fs, UserSystem& us);
+    ReservationSystem(FlightSystem& fs, UserSystem& us, const SnapshotData* tables = nullptr);
     ~ReservationSystem();
 
-    std::shared_ptr<Reservation> getReservationById(int resId);
-
+    // -- Console menus (prompt, then call the API below) :
     void displayReservations(int p_id) const;
-    void addReservation(const std::shared_ptr<Reservation>& r);
     void cancelReservation(int passengerId);
-    std::optional<std::pair<std::string, std::string>> checkReservation(const int& p_id, const int& r_id);
-
     void BookByAgent();
     void removeBooking();
     void modifyBooking();
-    
+
+    // -- Headless API, no console I/O. Returned pointers stay valid until that reservation is
+    //    cancelled, so they are for single-threaded callers (console, loaders), not the server :
+    Reservation* findReservation(int resId) const;
+    std::vector<Reservation*> getReservationsOf(int passengerId) const;
+    bool eraseReservation(int resId);
+    std::optional<std::pair<std::string, std::string>> checkReservation(const int& p_id, const int& r_id);
+    bool recordCheckIn(int resId);                  // false if there is no such reservation
+
+    // -- Thread-safe booking API, safe to call from many agent threads at once :
+    BookingResult book(const BookingRequest& request);
+    bool cancelBooking(int resId);
+    BookingResult changeSeat(int resId, int newSeat);
+    int availableSeats(const Flight& flight);      // seats left, read under the flight's lock
+    std::vector<ManifestEntry> getManifest(int flightNumber) const;    // copied out, sorted by seat
+    std::size_t manifestSize(int flightNumber) const;
+    CheckInResult checkIn(const std::vector<int>& resIds);   // one pass and one journal fsync per call
+    CheckInResult checkInFlight(int flightNumber);
 };
 
 #endif
\ No newline at end of file
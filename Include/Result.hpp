@@ -0,0 +1,19 @@
+#ifndef RESULT_HPP
+#define RESULT_HPP
+
+#include <string>
+
+// ===================================== OpResult ===================================== //
+// Outcome of a headless (prompt-free) system operation: the console menus print `error`,
+// other callers (batch jobs, the server, benchmarks) inspect it. `id` carries the id of the
+// entity an operation created, when it has one.
+struct OpResult {
+    bool ok = true;
+    std::string error;
+    int id = 0;
+
+    static OpResult success(int id = 0) { return OpResult{true, "", id}; }
+    static OpResult failure(const std::string& why) { return OpResult{false, why, 0}; }
+};
+
+#endif
@@ -0,0 +1,44 @@
+#ifndef ROUTEINDEX_HPP
+#define ROUTEINDEX_HPP
+
+#include <map>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "Interner.hpp"
+
+class Flight;
+
+// ===================================== RouteIndex Class ===================================== //
+// Secondary index of flights keyed by (origin, destination, departure day).
+// The day key is computed once when a flight is inserted, so searches only walk
+// the matching buckets instead of converting every flight's departure time.
+// Airports are interned symbols, so key compares are integer compares.
+
+struct RouteKey {
+    Symbol origin;
+    Symbol destination;
+    int day;                    // departure day at the origin (see Flight::getDepartureDay)
+
+    bool operator<(const RouteKey& other) const;
+};
+
+class RouteIndex {
+private:
+    using FlightList = std::vector<std::shared_ptr<Flight>>;
+    std::map<RouteKey, FlightList> buckets;
+    std::unordered_map<int, RouteKey> keysByFlight;    // flight number -> key it was filed under
+
+public:
+    void insert(const std::shared_ptr<Flight>& flight);
+    void erase(int flightNumber);
+    void update(const std::shared_ptr<Flight>& flight);   // re-file after route/time changes
+    void clear();
+
+    FlightList find(Symbol origin, Symbol destination, int day) const;
+    FlightList findInRange(Symbol origin, Symbol destination, int firstDay, int lastDay) const;
+    FlightList findFrom(Symbol origin, int firstDay, int lastDay) const;   // any destination
+};
+
+#endif
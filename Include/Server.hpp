@@ -0,0 +1,92 @@
+#ifndef SERVER_HPP
+#define SERVER_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+class FlightSystem;
+class ReservationSystem;
+
+// ===================================== Booking server ===================================== //
+// Local TCP server around the reservation core (AirlineReservationSystem --serve [port] [workers]).
+// Line protocol, one request per line, one response line per request, in order:
+//
+//     PING                                                  -> OK PONG
+//     SEARCH <origin> <destination|*> <YYYY-MM-DD>          -> OK <n> <flight>:<seatsLeft> ...
+//     BOOK <passengerId> <flight> <seat|0> <amount> <method> -> OK <reservationId> <seat>
+//     SEAT <reservationId> <newSeat>                        -> OK <reservationId> <seat>
+//     CANCEL <reservationId>                                -> OK
+//     CHECKIN <reservationId> ... | CHECKIN FLIGHT <flight>   -> OK <checkedIn> <alreadyCheckedIn> <notFound>
+//     MANIFEST <flight>                                     -> OK <n> <seat>:<reservationId>:<passengerId> ...
+//     QUIT                                                  -> OK BYE (then the server closes)
+//
+// Errors answer "ERR <reason>". The network side is one epoll event loop thread (non-blocking
+// sockets, edge-triggered); requests run on a worker pool against the thread-safe booking API.
+// A connection has at most one request on the workers at a time, so its responses keep order.
+// Only available on Linux; elsewhere run() reports that serve mode is unsupported.
+
+class BookingServer {
+private:
+    FlightSystem& flightSystem;
+    ReservationSystem& reservationSystem;
+    const int port;
+    const int workerCount;
+
+    struct Connection {
+        std::string in;                  // bytes received, not yet split into lines
+        std::deque<std::string> pending; // complete request lines waiting for a worker
+        std::string out;                 // responses not yet written
+        bool busy = false;               // a request of this connection is on the workers
+        bool closing = false;            // QUIT received or peer closed: close once drained
+    };
+    struct Job { int fd; std::string line; };
+    struct Done { int fd; std::string response; bool quit; };
+
+    std::unordered_map<int, Connection> connections;     // event loop thread only
+
+    std::mutex jobsMutex;
+    std::condition_variable jobsReady;
+    std::deque<Job> jobs;
+    std::mutex doneMutex;
+    std::vector<Done> done;
+
+    std::vector<std::thread> workers;
+    std::atomic<bool> stopping{false};
+    int listenFd = -1;
+    int epollFd = -1;
+    int wakeFd = -1;                     // eventfd: workers (and requestStop()) wake the event loop
+
+    void workerLoop();
+    void dispatch(int fd, Connection& c);
+    void acceptClients();
+    void readClient(int fd);
+    void flushClient(int fd);
+    void closeIfFinished(int fd);
+    void collectDone();
+    void wake();
+
+public:
+    BookingServer(FlightSystem& fs, ReservationSystem& rs, int port = 7070, int workers = 4);
+    ~BookingServer();
+
+    BookingServer(const BookingServer&) = delete;
+    BookingServer& operator=(const BookingServer&) = delete;
+
+    // Serve until stop() (or SIGINT / SIGTERM when started from main)
+    void run();
+    void stop();
+    // Just sets the flag and wakes the event loop, which then stops the workers; async-signal-safe
+    void requestStop();
+
+    // One protocol request -> one response line (without '\n'); usable without the network
+    std::string handle(const std::string& line);
+};
+
+#endif
@@ -0,0 +1,177 @@
+#ifndef SNAPSHOT_HPP
+#define SNAPSHOT_HPP
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+#include "Records.hpp"
+
+// ===================================== Binary snapshot format (v1) ===================================== //
+// One file holding every table of the database:
+//
+//     SnapshotHeader | section 0 | section 1 | ... | string table
+//
+// Each section is an array of fixed-width records in native (little-endian) byte order,
+// 8-byte aligned. Strings are (offset, length) references into the string table, so the
+// file can be memory-mapped and read in place with no parsing. The header also records
+// the size, nanosecond modification time and file id (inode) of each JSON file, taken just
+// before that file was read; a snapshot whose sources changed since is stale and startup
+// falls back to the JSON files.
+
+const std::string defaultSnapshotPath = "Database/Airline.snap";
+constexpr std::uint32_t snapshotVersion = 3;     // 2: times are UTC wall-clock minutes (was local midnight)
+                                                // 3: source stamps carry nanoseconds and the file id
+
+enum class SnapshotSection : std::uint32_t {aircraft, crew, users, flights, flightCrew, reservations, strings, count};
+enum class SnapshotSource : std::uint32_t {aircraft, crew, users, flights, reservations, count};
+
+// JSON file of each SnapshotSource (same paths the systems load from)
+extern const char* const snapshotSourceFiles[static_cast<int>(SnapshotSource::count)];
+
+struct SnapStr     { std::uint32_t offset; std::uint32_t length; };
+struct SnapSection { std::uint64_t offset; std::uint64_t count; std::uint32_t recordSize; std::uint32_t reserved; };
+struct SnapSource  { std::uint64_t size; std::int64_t mtime; std::uint64_t fileId; std::uint32_t mtimeNanos; std::uint32_t reserved; };
+
+struct SnapshotHeader {
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t headerSize;
+    SnapSection sections[static_cast<int>(SnapshotSection::count)];
+    SnapSource sources[static_cast<int>(SnapshotSource::count)];
+};
+
+struct SnapAircraft {
+    SnapStr model;
+    std::int32_t capacity;
+    std::uint8_t available;
+    std::uint8_t pad[3];
+    std::int64_t lastMaintenance;           // seconds since epoch
+    std::int64_t nextMaintenance;
+};
+
+struct SnapCrew {
+    std::int32_t crewID;
+    std::uint32_t pad;
+    SnapStr name;
+    SnapStr role;
+    double totalFlightHours;
+};
+
+struct SnapUser {
+    std::int32_t id;
+    std::uint8_t role;                      // Role
+    std::uint8_t pad[3];
+    SnapStr name;
+    SnapStr email;
+    SnapStr password;
+};
+
+struct SnapFlight {
+    std::int32_t flightNumber;
+    std::uint8_t status;                    // FlightStatus
+    std::uint8_t pad[3];
+    SnapStr origin;
+    SnapStr destination;
+    SnapStr aircraftModel;
+    std::int64_t departureTime;             // seconds since epoch
+    std::int64_t arrivalTime;
+    std::uint32_t crewFirst;                // range in the flightCrew section (int32 crew ids)
+    std::uint32_t crewCount;
+};
+
+struct SnapReservation {
+    std::int32_t reservationId;
+    std::int32_t passengerId;
+    std::int32_t flightNumber;
+    std::int32_t seatNumber;
+    std::int32_t amount;
+    std::uint32_t pad;
+    SnapStr checkIn;
+    SnapStr method;
+    SnapStr details;
+};
+
+// ===================================== SnapshotData ===================================== //
+// All tables as plain records: what the converter reads from / writes to either format.
+struct SnapshotData {
+    std::vector<AircraftRecord> aircrafts;
+    std::vector<CrewRecord> crew;
+    std::vector<UserRecord> users;
+    std::vector<FlightRecord> flights;
+    std::vector<ReservationRecord> reservations;
+    std::array<SnapSource, static_cast<int>(SnapshotSource::count)> sources{};   // stamps of the JSON files read
+};
+
+SnapshotData loadJsonDatabase();
+void stampSnapshotSources(SnapshotData& data);      // stamp the JSON files as they are now
+void saveJsonDatabase(const SnapshotData& data);
+void writeSnapshot(const std::string& path, const SnapshotData& data);
+
+// ===================================== SnapshotView Class ===================================== //
+// Read-only memory mapping of a snapshot file. Records can be used in place through
+// section<T>() / str(), or bulk-loaded into plain records.
+class SnapshotView {
+private:
+    const char* base = nullptr;
+    std::size_t length = 0;
+#if defined(_WIN32)
+    void* fileHandle = nullptr;
+    void* mappingHandle = nullptr;
+#endif
+
+    void validate() const;
+    void unmap();
+
+public:
+    explicit SnapshotView(const std::string& path);
+    ~SnapshotView();
+
+    SnapshotView(const SnapshotView&) = delete;
+    SnapshotView& operator=(const SnapshotView&) = delete;
+
+    const SnapshotHeader& header() const { return *reinterpret_cast<const SnapshotHeader*>(base); }
+    std::size_t count(SnapshotSection s) const { return header().sections[static_cast<int>(s)].count; }
+
+    template <typename T>
+    const T* section(SnapshotSection s) const {
+        return reinterpret_cast<const T*>(base + header().sections[static_cast<int>(s)].offset);
+    }
+    std::string_view str(const SnapStr& s) const;
+
+    // True if none of the source JSON files changed since the snapshot was written
+    bool isFresh() const;
+
+    std::vector<AircraftRecord> aircraftRecords() const;
+    std::vector<CrewRecord> crewRecords() const;
+    std::vector<UserRecord> userRecords() const;
+    std::vector<FlightRecord> flightRecords() const;
+    std::vector<ReservationRecord> reservationRecords() const;
+    SnapshotData load() const;
+};
+
+// The snapshot at `path` if it exists, is valid and is not stale; nullptr otherwise
+std::unique_ptr<SnapshotView> openFreshSnapshot(const std::string& path = defaultSnapshotPath);
+
+// Rewrites the snapshot at `path` from the JSON files if it exists and is stale; returns true if it did.
+// A database without a snapshot is left without one.
+bool refreshSnapshot(const std::string& path = defaultSnapshotPath);
+
+// ------ Every journal checkpoint rewrites a JSON file, which makes the snapshot stale. Declared before
+//        the systems, this runs after their journals have merged at shutdown and brings it up to date,
+//        so the next start loads the snapshot again (after a crash it stays stale and JSON is loaded) ------ //
+class SnapshotRefresh {
+private:
+    std::string path;
+public:
+    explicit SnapshotRefresh(std::string path = defaultSnapshotPath) : path(std::move(path)) {}
+    ~SnapshotRefresh() { refreshSnapshot(path); }
+
+    SnapshotRefresh(const SnapshotRefresh&) = delete;
+    SnapshotRefresh& operator=(const SnapshotRefresh&) = delete;
+};
+
+#endif
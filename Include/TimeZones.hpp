@@ -0,0 +1,34 @@
+#ifndef TIMEZONES_HPP
+#define TIMEZONES_HPP
+
+#include <cstdint>
+#include <string>
+#include "Aircraft.hpp"
+
+// ===================================== Airport time zones ===================================== //
+// Stored times are UTC (see parseDate). What a passenger calls "the flight on the 3rd" is the
+// departure date at the origin airport, so calendar days are taken in the origin's zone.
+// Zones are a built-in table: a standard UTC offset plus the daylight-saving rule the airport
+// follows, looked up by IATA code, city or (for the old sample data) country name.
+// Airports missing from the table are treated as UTC.
+
+enum class DstRule : std::uint8_t {
+    none,
+    europe,         // +1 h from the last Sunday of March to the last Sunday of October, 01:00 UTC
+    northAmerica,   // +1 h from the second Sunday of March to the first Sunday of November, 02:00 local
+    egypt,          // +1 h from the last Friday of April, 00:00 local, to the end of the last Thursday of October (since 2023)
+    lebanon         // +1 h from the last Sunday of March to the last Sunday of October, 00:00 local
+};
+
+struct AirportZone {
+    const char* name;           // IATA code, city or country
+    int utcOffsetMinutes;       // standard time
+    DstRule dst;
+};
+
+const AirportZone* findAirportZone(const std::string& airport);   // nullptr if unknown
+int utcOffsetMinutesAt(const AirportZone* zone, const timeType& tp);  // DST included, 0 for nullptr
+int localDayAt(const std::string& airport, const timeType& tp);       // calendar day number at the airport
+timeType localMidnightAt(const std::string& airport, int day);         // the instant `day` starts at the airport
+
+#endif
@@ -2,12 +2,23 @@
 #define USERSYSTEM_HPP
 
 #include "User.hpp"
+#include "Index.hpp"
+#include "Journal.hpp"
+#include "Records.hpp"
+#include "Result.hpp"
 #include <iostream>
 #include <fstream>
 #include <memory>
-#include <conio.h>
 #include <string>
 
+struct SnapshotData;
+
+// Fields to change in UserSystem::updateUser(id, update); empty strings keep the current value
+struct UserUpdate {
+    std::string name;
+    std::string email;
+    std::string password;
+};
 
 // ============================== UserSystem class ============================== //
 
@@ -15,26 +26,36 @@ class UserSystem{
 private:
     std::vector<std::shared_ptr<User>> users;
     std::vector<std::shared_ptr<Passenger>> passengers;
+    PrimaryIndex<int, User> usersById;
+    PrimaryIndex<std::string, User> usersByEmail;
+    Journal usersJournal;
     std::shared_ptr<User> inputUser;
     std::fstream Usersfile;
     Role role;
 
     bool isEmailUnique(const std::string& email) const; 
+    std::shared_ptr<User> userFromRecord(const UserRecord& r) const;
+    void insertUser(const std::shared_ptr<User>& user);
+    bool eraseUser(int userId);
 
 public: 
-    UserSystem();
+    explicit UserSystem(const SnapshotData* tables = nullptr);
     ~UserSystem();
 
-    std::shared_ptr<User> checkLogin(std::string& email, const std::string& password);
+    // -- Console menus (prompt, then call the API below) :
     bool login(const std::string& username, const std::string& password); 
-
     void addUser();
     void removeUser();
     void updateUser();
-    std::shared_ptr<User> getCurrentUser(const std::string& email) ;
-
     void displayUsers() const; 
+
+    // -- Headless API, no console I/O :
+    std::shared_ptr<User> authenticate(const std::string& email, const std::string& password) const;
+    std::shared_ptr<User> getCurrentUser(const std::string& email) ;
     std::shared_ptr<Passenger> getPassengerById(int id);
+    OpResult addUser(const UserRecord& user);       // id 0 = next free id, returned in OpResult::id
+    OpResult removeUser(int userId);
+    OpResult updateUser(int userId, const UserUpdate& update);
 
 };
 
@@ -0,0 +1,180 @@
+#ifndef BENCHHARNESS_HPP
+#define BENCHHARNESS_HPP
+
+// Minimal Google-Benchmark style harness for the bench/ programs (header only, no dependency).
+//
+//     void BM_Something(bench::State& state) {
+//         ... setup for state.range() rows ...          (not timed)
+//         while (state.keepRunning()) { ... }           (timed, run state.iterations() times)
+//         state.setItemsProcessed(state.iterations() * state.range());
+//     }
+//     BENCHMARK(BM_Something)->range(1000, 10000000);   // sizes 1K, 10K, ... 10M
+//     int main(int argc, char** argv) { return bench::runBenchmarks(argc, argv); }
+//
+// Each (benchmark, size) pair is re-run with more iterations until it takes at least --min-time.
+// Command line:  --filter=<substring>   --max=<largest size to run>   --min-time=<seconds>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace bench {
+
+using Clock = std::chrono::steady_clock;
+
+// ===================================== State Class ===================================== //
+class State {
+private:
+    const long size;
+    const long maxIterations;
+    long completed = 0;
+    long items = 0;
+    bool running = false;
+    Clock::time_point startedAt;
+    Clock::time_point pausedAt;
+    double pausedNs = 0;
+    double elapsedNs = 0;
+
+public:
+    State(long size, long iterations) : size(size), maxIterations(iterations) {}
+
+    long range() const { return size; }
+    long iterations() const { return maxIterations; }
+
+    // -- Timed loop: the clock starts on the first call and stops on the last one
+    bool keepRunning() {
+        if (!running && completed == 0) {
+            running = true;
+            startedAt = Clock::now();
+        }
+        if (completed == maxIterations) {
+            if (running) {
+                elapsedNs = std::chrono::duration<double, std::nano>(Clock::now() - startedAt).count() - pausedNs;
+                running = false;
+            }
+            return false;
+        }
+        ++completed;
+        return true;
+    }
+
+    // -- Exclude per-iteration setup from the measurement
+    void pauseTiming() { pausedAt = Clock::now(); }
+    void resumeTiming() { pausedNs += std::chrono::duration<double, std::nano>(Clock::now() - pausedAt).count(); }
+
+    void setItemsProcessed(long n) { items = n; }
+    long itemsProcessed() const { return items; }
+    double elapsedNanoseconds() const { return elapsedNs; }
+};
+
+// Keeps the compiler from optimizing a computed value away
+template <typename T>
+inline void doNotOptimize(const T& value) {
+    asm volatile("" : : "r,m"(value) : "memory");
+}
+
+// ===================================== Registry ===================================== //
+using BenchFn = void (*)(State&);
+
+class Benchmark {
+public:
+    std::string name;
+    BenchFn fn;
+    std::vector<long> sizes{1};
+
+    Benchmark(const std::string& name, BenchFn fn) : name(name), fn(fn) {}
+
+    // -- Sizes lo, lo*multiplier, ... up to hi
+    Benchmark* range(long lo, long hi, long multiplier = 10) {
+        sizes.clear();
+        for (long n = lo; n <= hi; n *= multiplier) sizes.push_back(n);
+        return this;
+    }
+    Benchmark* arg(long n) {
+        sizes = {n};
+        return this;
+    }
+};
+
+inline std::vector<Benchmark*>& registry() {
+    static std::vector<Benchmark*> benchmarks;
+    return benchmarks;
+}
+
+inline Benchmark* registerBenchmark(const char* name, BenchFn fn) {
+    registry().push_back(new Benchmark(name, fn));
+    return registry().back();
+}
+
+#define BENCH_CONCAT_(a, b) a##b
+#define BENCH_CONCAT(a, b) BENCH_CONCAT_(a, b)
+#define BENCHMARK(fn) static bench::Benchmark* BENCH_CONCAT(benchmark_, __LINE__) = bench::registerBenchmark(#fn, fn)
+
+// ===================================== Runner ===================================== //
+inline std::string humanSize(long n) {
+    if (n >= 1000000 && n % 1000000 == 0) return std::to_string(n / 1000000) + "M";
+    if (n >= 1000 && n % 1000 == 0) return std::to_string(n / 1000) + "K";
+    return std::to_string(n);
+}
+
+inline int runBenchmarks(int argc, char** argv) {
+    std::string filter;
+    long maxSize = 100000;          // keeps "make bench" short; pass --max=10000000 for the full sweep
+    double minTime = 0.2;
+    for (int i = 1; i < argc; i++) {
+        if (std::strncmp(argv[i], "--filter=", 9) == 0) filter = argv[i] + 9;
+        else if (std::strncmp(argv[i], "--max=", 6) == 0) maxSize = std::atol(argv[i] + 6);
+        else if (std::strncmp(argv[i], "--min-time=", 11) == 0) minTime = std::atof(argv[i] + 11);
+        else {
+            std::fprintf(stderr, "usage: %s [--filter=<substring>] [--max=<size>] [--min-time=<seconds>]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    std::printf("%-36s %14s %12s %14s %14s\n", "Benchmark", "Time/iter", "Iterations", "ns/item", "items/s");
+    std::printf("%s\n", std::string(94, '-').c_str());
+    for (Benchmark* b : registry()) {
+        if (!filter.empty() && b->name.find(filter) == std::string::npos) continue;
+        for (long size : b->sizes) {
+            if (size > maxSize) break;
+
+            // Grow the iteration count until one run lasts at least minTime
+            long iterations = 1;
+            double ns = 0;
+            long items = 0;
+            while (true) {
+                State state(size, iterations);
+                b->fn(state);
+                ns = state.elapsedNanoseconds();
+                items = state.itemsProcessed();
+                if (ns >= minTime * 1e9 || iterations >= 1000000000L) break;
+                double grow = ns > 0 ? (minTime * 1e9 * 1.4) / ns : 100.0;
+                iterations = static_cast<long>(iterations * std::min(std::max(grow, 2.0), 100.0));
+            }
+
+            std::string label = b->name + "/" + humanSize(size);
+            double perIter = ns / static_cast<double>(iterations);
+            const char* unit = "ns";
+            double shown = perIter;
+            if (shown >= 1e9) { shown /= 1e9; unit = "s"; }
+            else if (shown >= 1e6) { shown /= 1e6; unit = "ms"; }
+            else if (shown >= 1e3) { shown /= 1e3; unit = "us"; }
+            if (items > 0) {
+                std::printf("%-36s %11.2f %-2s %12ld %14.2f %14.3e\n", label.c_str(), shown, unit, iterations,
+                            ns / static_cast<double>(items), static_cast<double>(items) * 1e9 / ns);
+            } else {
+                std::printf("%-36s %11.2f %-2s %12ld %14s %14s\n", label.c_str(), shown, unit, iterations, "-", "-");
+            }
+            std::fflush(stdout);
+        }
+    }
+    return 0;
+}
+
+}
+
+#endif
@@ -0,0 +1,520 @@
+// Microbenchmarks for the core data paths, each at dataset sizes 1K .. 10M rows.
+// Build & run with:  make bench        (CoreBench --max=10000000 for the full sweep, --filter=Load to pick)
+// The JSON loaders read a generated database in CoreBench.db/<size> (n aircraft, crew, users,
+// flights and reservations); it is written once per size and reused by the other benchmarks.
+#include "BenchHarness.hpp"
+#include "../Include/Reservation.hpp"
+#include "../Include/Flight.hpp"
+#include "../Include/UserSystem.hpp"
+#include "../Include/Persistence.hpp"
+#include "../Include/Bootstrap.hpp"
+#include "../Include/BoardingPass.hpp"
+#include <filesystem>
+#include <map>
+#include <random>
+#include <sstream>
+
+namespace fs = std::filesystem;
+
+namespace {
+    const int capacity = 180;
+    const int aircraftModelsUsed = 50;          // flights pick from the first 50 models
+    const char* airports[] = {"CAI", "DXB", "JED", "LHR", "CDG", "FRA", "IST", "AMM", "DOH", "RUH"};
+
+    // ------ Silence the systems' console output while they load / destroy ------ //
+    class QuietCout {
+    private:
+        std::streambuf* saved;
+        std::ostringstream sink;
+    public:
+        QuietCout() : saved(std::cout.rdbuf(sink.rdbuf())) {}
+        ~QuietCout() { std::cout.rdbuf(saved); }
+    };
+
+    // ------ Run `fn` from inside a database directory (the systems use relative paths) ------ //
+    template <typename Fn>
+    void inDirectory(const fs::path& dir, Fn&& fn) {
+        const fs::path home = fs::current_path();
+        fs::current_path(dir);
+        try {
+            fn();
+        } catch (...) {
+            fs::current_path(home);
+            throw;
+        }
+        fs::current_path(home);
+    }
+
+    template <typename Record>
+    void writeTable(const fs::path& path, const std::vector<Record>& records) {
+        nlohmann::json jArray = nlohmann::json::array();
+        for (const auto& r : records) jArray.push_back(toJson(r));
+        writeFileAtomic(path.string(), jArray.dump(4));
+    }
+
+    FlightRecord makeFlight(long i, const timeType& base) {
+        FlightRecord f;
+        f.flightNumber = 1000 + static_cast<int>(i);
+        f.origin = airports[i % 10];
+        f.destination = airports[(i / 10 + 1 + i % 10) % 10];
+        f.aircraftModel = "Model-" + std::to_string(i % aircraftModelsUsed);
+        f.departureTime = base + std::chrono::hours(24 * (i % 365) + i % 24);
+        f.arrivalTime = f.departureTime + std::chrono::hours(3);
+        f.status = (i % 7 == 0) ? FlightStatus::delayed : FlightStatus::scheduled;
+        return f;
+    }
+
+    // ------ n rows in every table, written once per size ------ //
+    fs::path benchDatabase(long n) {
+        static std::map<long, fs::path> made;
+        auto it = made.find(n);
+        if (it != made.end()) return it->second;
+
+        const fs::path dir = fs::path("CoreBench.db") / std::to_string(n);
+        fs::remove_all(dir);
+        fs::create_directories(dir / "Database");
+        if (!fs::exists(dir / "database")) fs::create_directory_symlink("Database", dir / "database");
+        std::fprintf(stderr, "(writing %ld-row database in %s)\n", n, dir.string().c_str());
+
+        auto now = std::chrono::system_clock::now();
+        {
+            std::vector<AircraftRecord> aircraft(n);
+            for (long i = 0; i < n; i++) {
+                aircraft[i].model = "Model-" + std::to_string(i);
+                aircraft[i].capacity = capacity;
+                aircraft[i].lastMaintenance = now - std::chrono::hours(24 * 30);
+                aircraft[i].nextMaintenance = now + std::chrono::hours(24 * 365);
+            }
+            writeTable(dir / "Database/Aircrafts.json", aircraft);
+        }
+        {
+            std::vector<CrewRecord> crew(n);
+            for (long i = 0; i < n; i++) crew[i] = {static_cast<int>(i + 1), "Crew " + std::to_string(i + 1), i % 4 ? "Attendant" : "Pilot", 100.0 + i % 900};
+            writeTable(dir / "Database/Crew.json", crew);
+        }
+        {
+            std::vector<UserRecord> users(n);
+            for (long i = 0; i < n; i++) {
+                std::string id = std::to_string(i + 1);
+                users[i] = {static_cast<int>(i + 1), "Passenger " + id, "p" + id + "@bench", "pw", Role::passenger};
+            }
+            writeTable(dir / "Database/Users.json", users);
+        }
+        {
+            std::vector<FlightRecord> flights(n);
+            for (long i = 0; i < n; i++) flights[i] = makeFlight(i, now);
+            writeTable(dir / "Database/Flights.json", flights);
+        }
+        {
+            std::vector<ReservationRecord> reservations(n);
+            for (long i = 0; i < n; i++) {
+                ReservationRecord& r = reservations[i];
+                r.reservationId = static_cast<int>(i + 1);
+                r.passengerId = static_cast<int>(1 + (i * 7919) % n);
+                r.flightNumber = 1000 + static_cast<int>(i % n);
+                r.seatNumber = 1 + static_cast<int>((i / n) % capacity);
+                r.checkIn = "not yet";
+                r.method = "Cash";
+                r.details = "bench";
+                r.amount = 100 + static_cast<int>(i % 900);
+            }
+            writeTable(dir / "Database/Reservations.json", reservations);
+        }
+        made[n] = dir;
+        return dir;
+    }
+
+    // ------ Loaded systems for the lookup / serialization benchmarks (only the last size is kept) ------ //
+    struct World {
+        long size = -1;
+        std::unique_ptr<AircraftsSystem> aircraftSystem;
+        std::unique_ptr<UserSystem> userSystem;
+        std::unique_ptr<FlightSystem> flightSystem;
+
+        ~World() {
+            QuietCout quiet;
+            flightSystem.reset();
+            userSystem.reset();
+            aircraftSystem.reset();
+        }
+    };
+
+    World& worldOf(long n) {
+        static World world;
+        if (world.size == n) return world;
+        fs::path dir = benchDatabase(n);
+        QuietCout quiet;
+        world.flightSystem.reset();
+        world.userSystem.reset();
+        world.aircraftSystem.reset();
+        inDirectory(dir, [&] {
+            world.aircraftSystem.reset(new AircraftsSystem());
+            world.userSystem.reset(new UserSystem());
+            world.flightSystem.reset(new FlightSystem(*world.aircraftSystem));
+        });
+        world.size = n;
+        return world;
+    }
+
+    // Random existing keys, at most 1M of them so large sizes still fit in a reasonable loop
+    std::vector<int> randomFlightNumbers(long n) {
+        std::mt19937 rng(42);
+        std::vector<int> keys(std::min(n, 1000000L));
+        for (auto& k : keys) k = 1000 + static_cast<int>(rng() % n);
+        return keys;
+    }
+}
+
+// ===================================== SeatMap ===================================== //
+void BM_SeatMapBookUnbook(bench::State& state) {
+    const int n = static_cast<int>(state.range());
+    SeatMap seats(n);
+    std::vector<int> order(n);
+    for (int i = 0; i < n; i++) order[i] = i + 1;
+    std::shuffle(order.begin(), order.end(), std::mt19937(42));
+
+    while (state.keepRunning()) {
+        for (int s : order) seats.bookSeat(s);
+        for (int s : order) seats.unbookSeat(s);
+    }
+    bench::doNotOptimize(seats.seatsCount());
+    state.setItemsProcessed(state.iterations() * 2 * n);
+}
+BENCHMARK(BM_SeatMapBookUnbook)->range(1000, 10000000);
+
+void BM_SeatMapCount(bench::State& state) {
+    const int n = static_cast<int>(state.range());
+    SeatMap seats(n);
+    std::mt19937 rng(42);
+    for (int i = 0; i < n * 9 / 10; i++) seats.bookSeat(1 + static_cast<int>(rng() % n));
+
+    long total = 0;
+    while (state.keepRunning()) {
+        total += seats.freeSeatsInRange(1, n - 1);      // not the whole map, so the word scan runs
+        total += seats.seatsCount();
+    }
+    bench::doNotOptimize(total);
+    state.setItemsProcessed(state.iterations() * n);
+}
+BENCHMARK(BM_SeatMapCount)->range(1000, 10000000);
+
+// ===================================== FlightSystem ===================================== //
+void BM_GetFlightByNumber(bench::State& state) {
+    World& world = worldOf(state.range());
+    std::vector<int> keys = randomFlightNumbers(state.range());
+
+    long found = 0;
+    while (state.keepRunning()) {
+        for (int k : keys) found += world.flightSystem->getFlightByNumber(k) != nullptr;
+    }
+    bench::doNotOptimize(found);
+    state.setItemsProcessed(state.iterations() * static_cast<long>(keys.size()));
+}
+BENCHMARK(BM_GetFlightByNumber)->range(1000, 10000000);
+
+// Route index lookups, the query behind the search menu and the server's SEARCH
+void BM_FindFlights(bench::State& state) {
+    World& world = worldOf(state.range());
+    std::vector<std::shared_ptr<Flight>> probes;        // 1000 random flights' (origin, destination, day)
+    for (int number : randomFlightNumbers(state.range())) {
+        probes.push_back(world.flightSystem->getFlightByNumber(number));
+        if (probes.size() == 1000) break;
+    }
+
+    std::size_t found = 0;
+    while (state.keepRunning()) {
+        for (const auto& f : probes)
+            found += world.flightSystem->findFlights(f->getOrigin(), f->getDestination(), f->getDepartureDay()).size();
+    }
+    bench::doNotOptimize(found);
+    state.setItemsProcessed(state.iterations() * static_cast<long>(probes.size()));
+}
+BENCHMARK(BM_FindFlights)->range(1000, 10000000);
+
+// The linear search the console search menu used to do: one isFlightMatch() per flight
+void BM_IsFlightMatch(bench::State& state) {
+    World& world = worldOf(state.range());
+    const auto& flights = world.flightSystem->getFlights();
+    const timeType day = flights.front()->getDepartureTime();
+
+    long matches = 0;
+    while (state.keepRunning()) {
+        for (const auto& flight : flights) matches += flight->isFlightMatch("CAI", "DXB", day);
+    }
+    bench::doNotOptimize(matches);
+    state.setItemsProcessed(state.iterations() * static_cast<long>(flights.size()));
+}
+BENCHMARK(BM_IsFlightMatch)->range(1000, 10000000);
+
+void BM_FlightJson(bench::State& state) {
+    World& world = worldOf(state.range());
+    const auto& flights = world.flightSystem->getFlights();
+
+    std::size_t bytes = 0;
+    while (state.keepRunning()) {
+        for (const auto& flight : flights) bytes += flight->getFlightJson().dump().size();
+    }
+    bench::doNotOptimize(bytes);
+    state.setItemsProcessed(state.iterations() * static_cast<long>(flights.size()));
+}
+BENCHMARK(BM_FlightJson)->range(1000, 10000000);
+
+// "Delayed flights departing tomorrow from CAI", walking the Flight objects ...
+void BM_FilterFlightObjects(bench::State& state) {
+    World& world = worldOf(state.range());
+    const auto& flights = world.flightSystem->getFlights();
+    const int tomorrow = flights.front()->getDepartureDay() + 1;
+
+    long matches = 0;
+    while (state.keepRunning()) {
+        for (const auto& flight : flights) {
+            matches += flight->getStatus() == FlightStatus::delayed && flight->getDepartureDay() == tomorrow
+                       && flight->getOrigin() == "CAI";
+        }
+    }
+    bench::doNotOptimize(matches);
+    state.setItemsProcessed(state.iterations() * static_cast<long>(flights.size()));
+}
+BENCHMARK(BM_FilterFlightObjects)->range(1000, 10000000);
+
+// ... and scanning the FlightTable columns
+void BM_FilterFlightTable(bench::State& state) {
+    World& world = worldOf(state.range());
+    const FlightTable& table = world.flightSystem->getFlightTable();
+    FlightQuery query;
+    query.origin = "CAI";
+    query.firstDay = query.lastDay = world.flightSystem->getFlights().front()->getDepartureDay() + 1;
+    query.statuses = statusBit(FlightStatus::delayed);
+
+    std::size_t matches = 0;
+    while (state.keepRunning()) matches += table.count(query);
+    bench::doNotOptimize(matches);
+    state.setItemsProcessed(state.iterations() * static_cast<long>(table.size()));
+}
+BENCHMARK(BM_FilterFlightTable)->range(1000, 10000000);
+
+// Fare-search fan-out: "CAI -> DXB tomorrow, seats left", as searchFlight used to run it ...
+void BM_FilterIsFlightMatch(bench::State& state) {
+    World& world = worldOf(state.range());
+    const auto& flights = world.flightSystem->getFlights();
+    const timeType tomorrow(std::chrono::hours(24 * (flights.front()->getDepartureDay() + 1)));
+
+    long matches = 0;
+    while (state.keepRunning()) {
+        for (const auto& flight : flights) matches += flight->isFlightMatch("CAI", "DXB", tomorrow) && !flight->isFlightFull();
+    }
+    bench::doNotOptimize(matches);
+    state.setItemsProcessed(state.iterations() * static_cast<long>(flights.size()));
+}
+BENCHMARK(BM_FilterIsFlightMatch)->range(1000, 10000000);
+
+// ... and as a selection bitmap from each filter kernel (one the CPU lacks runs the scalar fallback)
+void filterKernelBench(bench::State& state, FilterIsa isa) {
+    World& world = worldOf(state.range());
+    const FlightTable& table = world.flightSystem->getFlightTable();
+    FlightQuery query;
+    query.origin = "CAI";
+    query.destination = "DXB";
+    query.firstDay = query.lastDay = world.flightSystem->getFlights().front()->getDepartureDay() + 1;
+    query.minSeatsFree = 1;
+
+    std::size_t matches = 0;
+    while (state.keepRunning()) matches += table.filter(query, isa).count();
+    bench::doNotOptimize(matches);
+    state.setItemsProcessed(state.iterations() * static_cast<long>(table.size()));
+}
+void BM_FilterKernelScalar(bench::State& state) { filterKernelBench(state, FilterIsa::scalar); }
+void BM_FilterKernelSse41(bench::State& state) { filterKernelBench(state, FilterIsa::sse41); }
+void BM_FilterKernelAvx2(bench::State& state) { filterKernelBench(state, FilterIsa::avx2); }
+BENCHMARK(BM_FilterKernelScalar)->range(1000, 10000000);
+BENCHMARK(BM_FilterKernelSse41)->range(1000, 10000000);
+BENCHMARK(BM_FilterKernelAvx2)->range(1000, 10000000);
+
+// ===================================== Date / time ===================================== //
+void BM_ParseDate(bench::State& state) {
+    const long n = state.range();
+    std::vector<std::string> dates(std::min(n, 1000000L));
+    for (std::size_t i = 0; i < dates.size(); i++)
+        dates[i] = formatDateTime(std::chrono::system_clock::now() + std::chrono::hours(24 * static_cast<long>(i % 3000)));
+
+    long long sum = 0;
+    while (state.keepRunning()) {
+        for (long i = 0; i < n; i++) sum += parseDate(dates[i % dates.size()]).time_since_epoch().count();
+    }
+    bench::doNotOptimize(sum);
+    state.setItemsProcessed(state.iterations() * n);
+}
+BENCHMARK(BM_ParseDate)->range(1000, 10000000);
+
+void BM_FormatDateTime(bench::State& state) {
+    const long n = state.range();
+    const timeType base = std::chrono::system_clock::now();
+
+    std::size_t length = 0;
+    while (state.keepRunning()) {
+        for (long i = 0; i < n; i++) length += formatDateTime(base + std::chrono::hours(i % 50000)).size();
+    }
+    bench::doNotOptimize(length);
+    state.setItemsProcessed(state.iterations() * n);
+}
+BENCHMARK(BM_FormatDateTime)->range(1000, 10000000);
+
+// The allocation-free overload used when the caller owns the buffer
+void BM_FormatDateTimeBuffer(bench::State& state) {
+    const long n = state.range();
+    const timeType base = std::chrono::system_clock::now();
+
+    char buffer[dateTimeLength + 1];
+    std::size_t checksum = 0;
+    while (state.keepRunning()) {
+        for (long i = 0; i < n; i++) {
+            formatDateTime(base + std::chrono::hours(i % 50000), buffer);
+            checksum += static_cast<unsigned char>(buffer[15]);
+        }
+    }
+    bench::doNotOptimize(checksum);
+    state.setItemsProcessed(state.iterations() * n);
+}
+BENCHMARK(BM_FormatDateTimeBuffer)->range(1000, 10000000);
+
+// ===================================== Boarding passes ===================================== //
+// n passes for one flight. The baseline is the old generateBoardingPass: one stream insertion
+// per line and the boarding time formatted again for every pass.
+namespace {
+    std::vector<ManifestEntry> benchManifest(long n) {
+        std::vector<ManifestEntry> manifest(n);
+        for (long i = 0; i < n; i++) {
+            manifest[i].seatNumber = 1 + static_cast<int>(i % capacity);
+            manifest[i].reservationId = static_cast<int>(i + 1);
+            manifest[i].passengerName = "Passenger " + std::to_string(i + 1);
+            manifest[i].checkedIn = true;
+        }
+        return manifest;
+    }
+}
+
+void BM_BoardingPassStream(bench::State& state) {
+    const std::vector<ManifestEntry> manifest = benchManifest(state.range());
+    const timeType departure = std::chrono::system_clock::now();
+    const std::string origin = "Cairo", destination = "Paris";
+
+    std::size_t bytes = 0;
+    while (state.keepRunning()) {
+        std::ostringstream out;
+        for (const auto& entry : manifest) {
+            out << "\n--- Boarding Pass ---\n";
+            out << "Passenger: " << entry.passengerName << "\n";
+            out << "Flight Number: " << 100 << "\n";
+            out << "From: " << origin << "\n";
+            out << "To: " << destination << "\n";
+            out << "Seat: " << entry.seatNumber << "\n";
+            out << "Boarding Time: " << formatDateTime(departure) << "\n";
+            out << "---------------------\n";
+        }
+        bytes += out.str().size();
+    }
+    bench::doNotOptimize(bytes);
+    state.setItemsProcessed(state.iterations() * state.range());
+}
+BENCHMARK(BM_BoardingPassStream)->range(100, 1000000);
+
+void boardingPassRenderBench(bench::State& state, PassFormat format) {
+    const std::vector<ManifestEntry> manifest = benchManifest(state.range());
+    BoardingPassRenderer renderer(format);
+    renderer.setFlight(100, "Cairo", "Paris", std::chrono::system_clock::now());
+
+    std::size_t bytes = 0;
+    while (state.keepRunning()) {
+        renderer.clear();
+        renderer.reserve(manifest.size());
+        for (const auto& entry : manifest) renderer.add(entry.passengerName, entry.seatNumber, entry.reservationId);
+        bytes += renderer.output().size();
+    }
+    bench::doNotOptimize(bytes);
+    state.setItemsProcessed(state.iterations() * state.range());
+}
+void BM_BoardingPassText(bench::State& state) { boardingPassRenderBench(state, PassFormat::text); }
+void BM_BoardingPassJson(bench::State& state) { boardingPassRenderBench(state, PassFormat::json); }
+void BM_BoardingPassPrintable(bench::State& state) { boardingPassRenderBench(state, PassFormat::printable); }
+BENCHMARK(BM_BoardingPassText)->range(100, 1000000);
+BENCHMARK(BM_BoardingPassJson)->range(100, 1000000);
+BENCHMARK(BM_BoardingPassPrintable)->range(100, 1000000);
+
+// ===================================== JSON loaders (system constructors) ===================================== //
+void BM_LoadAircrafts(bench::State& state) {
+    fs::path dir = benchDatabase(state.range());
+    QuietCout quiet;
+    inDirectory(dir, [&] {
+        while (state.keepRunning()) {
+            AircraftsSystem aircraftSystem;
+            bench::doNotOptimize(aircraftSystem.getAircrafts().size());
+        }
+    });
+    state.setItemsProcessed(state.iterations() * state.range());
+}
+BENCHMARK(BM_LoadAircrafts)->range(1000, 10000000);
+
+void BM_LoadUsers(bench::State& state) {
+    fs::path dir = benchDatabase(state.range());
+    QuietCout quiet;
+    inDirectory(dir, [&] {
+        while (state.keepRunning()) {
+            UserSystem userSystem;
+            bench::doNotOptimize(&userSystem);
+        }
+    });
+    state.setItemsProcessed(state.iterations() * state.range());
+}
+BENCHMARK(BM_LoadUsers)->range(1000, 10000000);
+
+// Flights and crew (both read by the FlightSystem constructor)
+void BM_LoadFlights(bench::State& state) {
+    World& world = worldOf(state.range());
+    fs::path dir = benchDatabase(state.range());
+    QuietCout quiet;
+    inDirectory(dir, [&] {
+        while (state.keepRunning()) {
+            FlightSystem flightSystem(*world.aircraftSystem);
+            bench::doNotOptimize(flightSystem.getFlights().size());
+        }
+    });
+    state.setItemsProcessed(state.iterations() * 2 * state.range());
+}
+BENCHMARK(BM_LoadFlights)->range(1000, 10000000);
+
+void BM_LoadReservations(bench::State& state) {
+    World& world = worldOf(state.range());
+    fs::path dir = benchDatabase(state.range());
+    QuietCout quiet;
+    inDirectory(dir, [&] {
+        while (state.keepRunning()) {
+            auto reservationSystem = std::make_unique<ReservationSystem>(*world.flightSystem, *world.userSystem);
+            state.pauseTiming();
+            reservationSystem.reset();      // the destructor logs every reservation, keep it out of the time
+            state.resumeTiming();
+        }
+    });
+    state.setItemsProcessed(state.iterations() * state.range());
+}
+BENCHMARK(BM_LoadReservations)->range(1000, 10000000);
+
+// Startup parse phase: all five tables into records, on one thread and on one per core (up to one per table)
+void bootstrapParseBench(bench::State& state, unsigned threads) {
+    fs::path dir = benchDatabase(state.range());
+    QuietCout quiet;
+    inDirectory(dir, [&] {
+        while (state.keepRunning()) {
+            Bootstrap boot(threads);
+            bench::doNotOptimize(boot.parseMilliseconds());
+        }
+    });
+    state.setItemsProcessed(state.iterations() * 5 * state.range());
+}
+void BM_BootstrapParseSerial(bench::State& state) { bootstrapParseBench(state, 1); }
+void BM_BootstrapParseParallel(bench::State& state) { bootstrapParseBench(state, std::thread::hardware_concurrency()); }
+BENCHMARK(BM_BootstrapParseSerial)->range(1000, 10000000);
+BENCHMARK(BM_BootstrapParseParallel)->range(1000, 10000000);
+
+int main(int argc, char** argv) {
+    return bench::runBenchmarks(argc, argv);
+}
@@ -0,0 +1,123 @@
+// Reservation storage benchmark : one make_shared per reservation (vector + shared_ptr id index)
+// vs the ReservationSystem layout (ObjectPool slots + id -> PoolHandle index).
+// Reports build time, id lookup time, heap bytes requested and heap allocations for each
+// (malloc's own per-block overhead comes on top, so the real saving is larger).
+// Build & run with:  make bench        (optional argument: number of reservations, default 1000000)
+#include "../Include/ObjectPool.hpp"
+#include "../Include/Index.hpp"
+#include "../Include/Reservation.hpp"
+#include "../Include/User.hpp"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <unordered_map>
+
+// ------ Heap accounting: bytes and calls through operator new (both containers reserve up front,
+//        so nothing is freed while a layout is being built) ------ //
+namespace {
+    std::size_t heapBytes = 0;
+    std::size_t heapAllocations = 0;
+}
+
+__attribute__((noinline)) void* operator new(std::size_t size) {
+    heapBytes += size;
+    ++heapAllocations;
+    if (void* p = std::malloc(size ? size : 1)) return p;
+    throw std::bad_alloc();
+}
+__attribute__((noinline)) void operator delete(void* p) noexcept { std::free(p); }
+__attribute__((noinline)) void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+
+using benchClock = std::chrono::steady_clock;
+
+template <typename Fn>
+double msFor(Fn&& fn) {
+    auto start = benchClock::now();
+    fn();
+    return std::chrono::duration<double, std::milli>(benchClock::now() - start).count();
+}
+
+static volatile long long sink = 0;
+
+struct Measured {
+    double buildMs, lookupMs;
+    std::size_t bytes, allocations;
+};
+
+static void report(const char* name, const Measured& m, int count) {
+    std::printf("%-28s build %8.1f ms   lookup %6.1f ns   heap %7.1f MB (%5.1f B/res)   allocations %9zu\n",
+                name, m.buildMs, m.lookupMs * 1e6 / count, m.bytes / 1e6,
+                static_cast<double>(m.bytes) / count, m.allocations);
+}
+
+int main(int argc, char** argv) {
+    const int count = argc > 1 ? std::atoi(argv[1]) : 1000000;
+    const char* methods[] = {"Credit Card", "Cash", "Paypal"};
+
+    // Reservations share a few thousand passengers, like a loaded database
+    std::vector<std::shared_ptr<Passenger>> passengers;
+    for (int i = 0; i < 5000; i++) passengers.push_back(std::make_shared<Passenger>("Passenger", "", "", i + 1));
+    std::vector<int> probes(count);
+    for (int i = 0; i < count; i++) probes[i] = 1 + static_cast<int>((i * 7919LL) % count);
+
+    // Reservation destructors log to cout
+    std::ostringstream quiet;
+    std::streambuf* savedCout = std::cout.rdbuf(quiet.rdbuf());
+
+    std::printf("--- Reservation storage benchmark (%d reservations) ---\n", count);
+
+    Measured shared{};
+    {
+        std::size_t bytesBefore = heapBytes, allocationsBefore = heapAllocations;
+        std::vector<std::shared_ptr<Reservation>> reservations;
+        PrimaryIndex<int, Reservation> byId;
+        shared.buildMs = msFor([&] {
+            reservations.reserve(count);
+            byId.reserve(count);
+            for (int i = 0; i < count; i++) {
+                auto r = std::make_shared<Reservation>(i + 1, passengers[i % 5000], nullptr, 1 + i % 180,
+                                                       methods[i % 3], "card", 200 + i % 700);
+                byId.insert(i + 1, r);
+                reservations.push_back(r);
+            }
+        });
+        shared.bytes = heapBytes - bytesBefore;
+        shared.allocations = heapAllocations - allocationsBefore;
+        shared.lookupMs = msFor([&] {
+            for (int id : probes) sink += byId.find(id)->getSeatNo();
+        });
+        quiet.str("");
+    }
+
+    Measured pooled{};
+    {
+        std::size_t bytesBefore = heapBytes, allocationsBefore = heapAllocations;
+        ObjectPool<Reservation> reservations;
+        std::unordered_map<int, PoolHandle> byId;
+        pooled.buildMs = msFor([&] {
+            reservations.reserve(count);
+            byId.reserve(count);
+            for (int i = 0; i < count; i++) {
+                byId.emplace(i + 1, reservations.create(i + 1, passengers[i % 5000], nullptr, 1 + i % 180,
+                                                        methods[i % 3], "card", 200 + i % 700));
+            }
+        });
+        pooled.bytes = heapBytes - bytesBefore;
+        pooled.allocations = heapAllocations - allocationsBefore;
+        pooled.lookupMs = msFor([&] {
+            for (int id : probes) sink += reservations.get(byId.find(id)->second)->getSeatNo();
+        });
+        quiet.str("");
+    }
+
+    std::cout.rdbuf(savedCout);
+    report("make_shared + vector + index", shared, count);
+    report("ObjectPool + handle index", pooled, count);
+    std::printf("pool saves %.1f MB (%.0f%%) and %zu allocations; build %.2fx faster\n",
+                (static_cast<double>(shared.bytes) - pooled.bytes) / 1e6,
+                100.0 * (1.0 - static_cast<double>(pooled.bytes) / shared.bytes),
+                shared.allocations - pooled.allocations, shared.buildMs / pooled.buildMs);
+    return 0;
+}
@@ -0,0 +1,99 @@
+// SeatMap microbenchmark : packed bitset SeatMap vs the previous std::map<int,bool> version.
+// Build & run with:  make bench
+#include "../Include/Flight.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <random>
+
+// ===================================== Previous std::map SeatMap ===================================== //
+class LegacySeatMap {
+private:
+    std::map<int, bool> seatsAvailability;
+    const int totalSeats;
+
+public:
+    LegacySeatMap(int seatNum) : totalSeats(seatNum) {
+        for (int i = 1; i <= totalSeats; i++) seatsAvailability.emplace(i, true);
+    }
+    bool bookSeat(int num) {
+        auto it = seatsAvailability.find(num);
+        if (it != seatsAvailability.end() && it->second) { it->second = false; return true; }
+        return false;
+    }
+    bool unbookSeat(int num) {
+        auto it = seatsAvailability.find(num);
+        if (it != seatsAvailability.end() && !it->second) { it->second = true; return true; }
+        return false;
+    }
+    int seatsCount() {
+        int count = 0;
+        for (const auto& seat : seatsAvailability) if (seat.second) count++;
+        return count;
+    }
+    int firstFreeSeat() {
+        for (const auto& seat : seatsAvailability) if (seat.second) return seat.first;
+        return 0;
+    }
+    void resetMap() {
+        for (auto& seat : seatsAvailability) seat.second = true;
+    }
+};
+
+// ===================================== Benchmark helpers ===================================== //
+using benchClock = std::chrono::steady_clock;
+
+template <typename Fn>
+double nsPerOp(long ops, Fn&& fn) {
+    auto start = benchClock::now();
+    fn();
+    auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(benchClock::now() - start).count();
+    return static_cast<double>(ns) / ops;
+}
+
+static volatile long sink = 0;
+
+// Book seats in random order, count free seats after every booking (the isFlightFull() pattern),
+// look up the next free seat, then release everything.
+template <typename Map>
+void runSuite(const char* name, int seats, int flights) {
+    std::vector<Map> maps;
+    maps.reserve(flights);
+    for (int f = 0; f < flights; f++) maps.emplace_back(seats);
+
+    std::vector<int> order(seats);
+    for (int i = 0; i < seats; i++) order[i] = i + 1;
+    std::shuffle(order.begin(), order.end(), std::mt19937(42));
+
+    const long ops = static_cast<long>(seats) * flights;
+    double book = nsPerOp(ops, [&] {
+        for (auto& m : maps) for (int s : order) sink += m.bookSeat(s);
+    });
+    for (auto& m : maps) m.resetMap();
+
+    double count = nsPerOp(ops, [&] {
+        for (auto& m : maps) for (int s : order) { m.bookSeat(s); sink += m.seatsCount(); }
+    });
+    for (auto& m : maps) { m.resetMap(); for (int i = 0; i < seats * 9 / 10; i++) m.bookSeat(order[i]); }
+
+    double firstFree = nsPerOp(flights, [&] {
+        for (auto& m : maps) sink += m.firstFreeSeat();
+    });
+
+    double unbook = nsPerOp(ops, [&] {
+        for (auto& m : maps) for (int s : order) sink += m.unbookSeat(s);
+    });
+
+    std::printf("%-8s seats=%-4d flights=%-6d book %7.1f ns  book+count %8.1f ns  firstFree %8.1f ns  unbook %7.1f ns\n",
+                name, seats, flights, book, count, firstFree, unbook);
+}
+
+int main() {
+    std::printf("--- SeatMap benchmark (ns per operation) ---\n");
+    const int sizes[][2] = { {100, 10000}, {180, 10000}, {450, 5000} };
+    for (const auto& sz : sizes) {
+        runSuite<LegacySeatMap>("std::map", sz[0], sz[1]);
+        runSuite<SeatMap>("bitset", sz[0], sz[1]);
+    }
+    return 0;
+}
@@ -0,0 +1,86 @@
+// Startup load benchmark : Reservations parsed from a JSON array (DOM and SAX stream) vs read from a mapped snapshot.
+// Build & run with:  make bench        (optional argument: number of reservations, default 1000000)
+#include "../Include/Snapshot.hpp"
+#include "../Include/Persistence.hpp"
+#include "../Include/RecordStream.hpp"
+#include <fstream>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+using benchClock = std::chrono::steady_clock;
+
+template <typename Fn>
+double msFor(Fn&& fn) {
+    auto start = benchClock::now();
+    fn();
+    return std::chrono::duration<double, std::milli>(benchClock::now() - start).count();
+}
+
+static volatile long long sink = 0;
+
+int main(int argc, char** argv) {
+    const int count = argc > 1 ? std::atoi(argv[1]) : 1000000;
+    const std::string jsonPath = "StartupBench.json";
+    const std::string snapPath = "StartupBench.snap";
+    const char* methods[] = {"Credit Card", "Cash", "Paypal"};
+
+    SnapshotData data;
+    data.reservations.reserve(count);
+    for (int i = 0; i < count; i++) {
+        ReservationRecord r;
+        r.reservationId = i + 1;
+        r.passengerId = 1 + i % 5000;
+        r.flightNumber = 100 + i % 800;
+        r.seatNumber = 1 + i % 180;
+        r.checkIn = (i % 3 == 0) ? "checked In" : "not yet";
+        r.method = methods[i % 3];
+        r.details = "card-" + std::to_string(1000 + i % 9000);
+        r.amount = 200 + i % 700;
+        data.reservations.push_back(r);
+    }
+
+    nlohmann::json jArray = nlohmann::json::array();
+    for (const auto& r : data.reservations) jArray.push_back(toJson(r));
+    writeFileAtomic(jsonPath, jArray.dump(4));
+    jArray = nlohmann::json();
+    writeSnapshot(snapPath, data);
+
+    std::printf("--- Startup load benchmark (%d reservations) ---\n", count);
+
+    double domMs = msFor([&] {
+        std::ifstream file(jsonPath);
+        nlohmann::json j;
+        file >> j;
+        std::vector<ReservationRecord> records;
+        records.reserve(j.size());
+        for (const auto& item : j) records.push_back(reservationRecordFromJson(item));
+        sink += static_cast<long long>(records.size());
+    });
+    double jsonMs = msFor([&] {
+        sink += static_cast<long long>(streamReservationRecords(jsonPath, [](ReservationRecord&& r) { sink += r.amount; }));
+    });
+    double openMs = msFor([&] {
+        SnapshotView view(snapPath);
+        sink += static_cast<long long>(view.count(SnapshotSection::reservations));
+    });
+    double scanMs = msFor([&] {
+        SnapshotView view(snapPath);
+        const SnapReservation* rows = view.section<SnapReservation>(SnapshotSection::reservations);
+        for (std::size_t i = 0; i < view.count(SnapshotSection::reservations); i++) sink += rows[i].amount;
+    });
+    double loadMs = msFor([&] {
+        SnapshotView view(snapPath);
+        sink += static_cast<long long>(view.reservationRecords().size());
+    });
+
+    std::printf("JSON DOM -> records        %9.1f ms\n", domMs);
+    std::printf("JSON SAX stream -> records %9.1f ms\n", jsonMs);
+    std::printf("snapshot map + validate    %9.1f ms\n", openMs);
+    std::printf("snapshot map + scan        %9.1f ms\n", scanMs);
+    std::printf("snapshot map -> records    %9.1f ms   (%.1fx faster than the JSON stream)\n", loadMs, jsonMs / loadMs);
+
+    std::remove(jsonPath.c_str());
+    std::remove(snapPath.c_str());
+    return 0;
+}
@@ -1,35 +1,148 @@
 #include "../Include/Aircraft.hpp"
 #include "../Include/Flight.hpp"
+#include "../Include/Persistence.hpp"
+#include "../Include/Snapshot.hpp"
+#include <algorithm>
 #include <iostream>
 #include <chrono>
 #include <fstream>
-#include <iomanip>
 #include "../include/json.hpp"
 
 // ===================================== Time Functions ===================================== //
 
-// --- Convert time_point to string :
-const std::string formatDateTime(const timeType& tp) {
-    std::time_t timeT = std::chrono::system_clock::to_time_t(tp);
-    std::tm* tm = std::localtime(&timeT);
-    std::ostringstream oss;
-    oss << std::put_time(tm, "%Y-%m-%d");
-    return oss.str();
+// Times are kept as wall-clock minutes in plain UTC epoch arithmetic: no locale, no TZ database,
+// no static buffers, so parsing and formatting are thread-safe and never allocate.
+
+namespace {
+    constexpr long long secondsPerDay = 86400;
+
+    bool isLeapYear(int year) {
+        return (year % 4 == 0 && year % 100 != 0) || year % 400 == 0;
+    }
+
+    int daysInMonth(int year, int month) {
+        static const int days[] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+        return month == 2 && isLeapYear(year) ? 29 : days[month - 1];
+    }
+
+    // --- Fixed-width decimal field, false on any non-digit :
+    bool readDigits(const char* text, int count, int& value) {
+        value = 0;
+        for (int i = 0; i < count; i++) {
+            if (text[i] < '0' || text[i] > '9') return false;
+            value = value * 10 + (text[i] - '0');
+        }
+        return true;
+    }
+
+    void writeDigits(char* out, int count, int value) {
+        for (int i = count - 1; i >= 0; i--) {
+            out[i] = static_cast<char>('0' + value % 10);
+            value /= 10;
+        }
+    }
+
+    long long floorDiv(long long a, long long b) {
+        return a / b - ((a % b != 0) && ((a < 0) != (b < 0)));
+    }
+}
+
+// --- "YYYY-MM-DD" or "YYYY-MM-DD HH:MM" (trailing blanks allowed) :
+bool tryParseDate(const char* text, std::size_t length, timeType& out) {
+    while (length > 0 && (text[length - 1] == ' ' || text[length - 1] == '\r' || text[length - 1] == '\t')) length--;
+    if (length != 10 && length != 16) return false;
+
+    int year, month, day, hour = 0, minute = 0;
+    if (!readDigits(text, 4, year) || text[4] != '-' || !readDigits(text + 5, 2, month) || text[7] != '-' ||
+        !readDigits(text + 8, 2, day))
+        return false;
+    if (month < 1 || month > 12 || day < 1 || day > daysInMonth(year, month)) return false;
+
+    if (length == 16) {
+        if (text[10] != ' ' || !readDigits(text + 11, 2, hour) || text[13] != ':' || !readDigits(text + 14, 2, minute))
+            return false;
+        if (hour > 23 || minute > 59) return false;
+    }
+
+    long long seconds = static_cast<long long>(daysFromCivil(year, month, day)) * secondsPerDay + hour * 3600 + minute * 60;
+    out = timeType(std::chrono::duration_cast<timeType::duration>(std::chrono::seconds(seconds)));
+    return true;
+}
+
+bool isDateOnly(const std::string& str) {
+    std::size_t length = str.size();
+    while (length > 0 && (str[length - 1] == ' ' || str[length - 1] == '\r' || str[length - 1] == '\t')) length--;
+    return length == 10;
 }
 
 timeType parseDate(const std::string& str) {
-    std::tm tm = {};
-    std::istringstream ss(str);
-    ss >> std::get_time(&tm, "%Y-%m-%d");
-    if (ss.fail()) throw std::runtime_error("Invalid date: " + str);
-    return std::chrono::system_clock::from_time_t(std::mktime(&tm));
+    timeType tp;
+    if (!tryParseDate(str.data(), str.size(), tp)) throw std::runtime_error("Invalid date: " + str);
+    return tp;
+}
+
+// --- Writes "YYYY-MM-DD HH:MM" and a terminating '\0' (dateTimeLength + 1 bytes) :
+std::size_t formatDateTime(const timeType& tp, char* buffer) {
+    const long long seconds = std::chrono::duration_cast<std::chrono::seconds>(tp.time_since_epoch()).count();
+    const long long days = floorDiv(seconds, secondsPerDay);
+    const int secondOfDay = static_cast<int>(seconds - days * secondsPerDay);
+
+    int year, month, day;
+    civilFromDays(days, year, month, day);
+    if (year < 0 || year > 9999) year = year < 0 ? 0 : 9999;     // keep the fixed width
+
+    writeDigits(buffer, 4, year);
+    buffer[4] = '-';
+    writeDigits(buffer + 5, 2, month);
+    buffer[7] = '-';
+    writeDigits(buffer + 8, 2, day);
+    buffer[10] = ' ';
+    writeDigits(buffer + 11, 2, secondOfDay / 3600);
+    buffer[13] = ':';
+    writeDigits(buffer + 14, 2, secondOfDay / 60 % 60);
+    buffer[dateTimeLength] = '\0';
+    return dateTimeLength;
+}
+
+const std::string formatDateTime(const timeType& tp) {
+    char buffer[dateTimeLength + 1];
+    return std::string(buffer, formatDateTime(tp, buffer));
+}
+
+// --- Day number of a civil date (Howard Hinnant's days_from_civil) :
+int daysFromCivil(int year, int month, int day) {
+    year -= month <= 2;
+    const int era = (year >= 0 ? year : year - 399) / 400;
+    const int yoe = year - era * 400;                                    // [0, 399]
+    const int doy = (153 * (month + (month > 2 ? -3 : 9)) + 2) / 5 + day - 1; // [0, 365]
+    const int doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;               // [0, 146096]
+    return era * 146097 + doe - 719468;
+}
+
+// --- Civil date of a day number (Howard Hinnant's civil_from_days) :
+void civilFromDays(long long days, int& year, int& month, int& day) {
+    days += 719468;
+    const long long era = (days >= 0 ? days : days - 146096) / 146097;
+    const long long doe = days - era * 146097;                                  // [0, 146096]
+    const long long yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365; // [0, 399]
+    const long long doy = doe - (365 * yoe + yoe / 4 - yoe / 100);              // [0, 365]
+    const long long mp = (5 * doy + 2) / 153;                                   // [0, 11]
+    day = static_cast<int>(doy - (153 * mp + 2) / 5 + 1);
+    month = static_cast<int>(mp < 10 ? mp + 3 : mp - 9);
+    year = static_cast<int>(yoe + era * 400 + (month <= 2));
+}
+
+// --- UTC calendar day of a time point, comparable as a plain int :
+int toUtcDay(const timeType& tp) {
+    const long long seconds = std::chrono::duration_cast<std::chrono::seconds>(tp.time_since_epoch()).count();
+    return static_cast<int>(floorDiv(seconds, secondsPerDay));
 }
 
 // =====================================   Aircraft Class functions   ===================================== //
 
 Aircraft::Aircraft(const std::string& model, int capacity, bool av, 
     const timeType& last, const timeType& next):
-    model(model), capacity(capacity), available(av), lastMaintenance(last), nextMaintenance(next){}
+    model(intern(model)), capacity(capacity), available(av), lastMaintenance(last), nextMaintenance(next){}
 
 // --- Checking maintenance & availabilty of the aircraft:
 
@@ -63,7 +176,7 @@ void Aircraft::updateMaintenanceSchedule(const timeType& newLast, const timeType
 
 // ---- Getters  :
 const std::string& Aircraft::getModel() const{
-    return model;
+    return model.str();
 }
 
 int Aircraft::getCapacity() const{
@@ -81,7 +194,7 @@ void Aircraft::displayAircraftInfo() const{
 
 nlohmann::json Aircraft::getAircraftJson() const {
     return {
-        {"model", model},
+        {"model", model.str()},
         {"capacity", capacity},
         {"available", available},
         {"lastMaintenance", formatDateTime(lastMaintenance)},
@@ -91,37 +204,25 @@ nlohmann::json Aircraft::getAircraftJson() const {
 
 // =====================================   AircraftsSystem class functions   ===================================== //
 
-// ------------ Constructor: Loads aircraft data from JSON file ----------- //
-AircraftsSystem::AircraftsSystem() {
-    std::ifstream aircraftsFile("database/Aircrafts.json");
-    if (!aircraftsFile.is_open()) {
-        throw std::runtime_error("Could not open Aircrafts.json");
-    }
-
-    nlohmann::json j;
-    aircraftsFile >> j; // Read the full JSON array from file
+// ------------ Constructor: Loads aircraft data from the startup tables or JSON file ----------- //
+AircraftsSystem::AircraftsSystem(const SnapshotData* tables) {
+    std::vector<AircraftRecord> loaded;
+    if (!tables) loaded = loadAircraftRecords("database/Aircrafts.json");
+    const std::vector<AircraftRecord>& records = tables ? tables->aircrafts : loaded;
 
-    // Iterate over each aircraft entry in the JSON array
-    for (const auto& item : j) {
-        std::string type        = item["model"];
-        int numPass             = item["capacity"];
-        bool av                 = item["available"];
-        std::string lastMain    = item["lastMaintenance"];
-        std::string nextMain    = item["nextMaintenance"];
-
-        // Create Aircraft object and add to aircrafts vector
-        aircrafts.push_back(std::make_shared<Aircraft>(type, numPass, av, parseDate(lastMain), parseDate(nextMain)));
+    aircrafts.reserve(records.size());
+    for (const auto& r : records) {
+        aircrafts.push_back(std::make_shared<Aircraft>(r.model, r.capacity, r.available, r.lastMaintenance, r.nextMaintenance));
     }
 }
 
-// --------- Destructor: Saves aircraft data back to JSON file --------- //
-AircraftsSystem::~AircraftsSystem() {
+// --------- Write all aircrafts to Aircrafts.json (atomic replace) --------- //
+void AircraftsSystem::saveAircrafts() const {
     nlohmann::json jArray = nlohmann::json::array();
     for (auto& aircraft : aircrafts) {
         jArray.push_back(aircraft->getAircraftJson());
     }
-    std::ofstream outFile("database/Aircrafts.json");
-    outFile << jArray.dump(4);
+    writeFileAtomic("database/Aircrafts.json", jArray.dump(4));
 }
 
 // -------------- Display all aircrafts in the system ----------------------- //
@@ -135,14 +236,18 @@ void AircraftsSystem::displayAircrafts() const {
     }
 }
 
-// -------------- Select an aircraft from the list ----------------------- //
-int AircraftsSystem::selectAircraft() const{
+// -------------- Select an aircraft from the list (nullptr on a bad choice) ----------------------- //
+std::shared_ptr<Aircraft> AircraftsSystem::selectAircraft() const{
     displayAircrafts();
     std::cout << "Please enter the number of the aircraft you want to select: " << std::endl;
     int choice;
     std::cin >> choice;
 
-    return choice - 1;
+    if (choice < 1 || choice > static_cast<int>(aircrafts.size())) {
+        std::cout << "Invalid aircraft number.\n";
+        return nullptr;
+    }
+    return aircrafts[choice - 1];
 }
 
 // -------------- Add an aircraft to the system and save it to the Aircrafts.json file :
@@ -152,49 +257,32 @@ void AircraftsSystem::addAircraft(){
 
         std::cout << "Enter aircraft model: ";
         std::getline(std::cin >> std::ws, model); // Use std::ws to consume any leading whitespace
-         if (model.empty()) {
-            std::cout << "Aircraft model cannot be empty. Please try again.\n";
-            return;
-        }
         std::cout << "Enter aircraft capacity: ";
         std::cin >> capacity;
 
-        auto aircraft = std::make_shared<Aircraft>(model, capacity);
-        aircrafts.push_back(aircraft);
-
-        nlohmann::json jArray = nlohmann::json::array();
-        for (auto& craft : aircrafts) { 
-            jArray.push_back(craft->getAircraftJson());
+    OpResult result = addAircraft(model, capacity);
+    if (!result.ok) {
+        std::cout << result.error << " Please try again.\n";
+        return;
     }
-
-    // --- Save to JSON file after adding
-    std::ofstream outFile("database/Aircrafts.json");
-    outFile << jArray.dump(4);
     std::cout << "Aircraft added successfully.\n";
 }
 
 // ---- Remove an aircraft from the system :
 
 void AircraftsSystem::removeAircraft(){
-    int choice = selectAircraft(); 
+    auto aircraft = selectAircraft();
+    if (!aircraft) return;
 
-    aircrafts.erase(aircrafts.begin() + choice);
-    // --- Rebuild JSON array from remaining aircrafts
-    nlohmann::json jArray = nlohmann::json::array();
-    for (auto& craft : aircrafts) {
-        jArray.push_back(craft->getAircraftJson());
-    }
-    // Save back to file
-    std::ofstream outFile("database/Aircrafts.json");
-    outFile << jArray.dump(4);  
-    std::cout << "Aircraft removed successfully.\n";
+    OpResult result = removeAircraft(aircraft->getModel());
+    std::cout << (result.ok ? "Aircraft removed successfully.\n" : result.error + "\n");
 }
 
 // ----------------------- Log maintenance of an aircraft ------------------------- //
 
 void AircraftsSystem::logMaintenance() {
-    int choice = selectAircraft();
-    auto aircraft = aircrafts[choice];
+    auto aircraft = selectAircraft();
+    if (!aircraft) return;
 
     std::string lastStr, nextStr;
     std::cout << "Enter last maintenance date (YYYY-MM-DD): ";
@@ -203,17 +291,8 @@ void AircraftsSystem::logMaintenance() {
     std::cin >> nextStr;
 
     try {
-        timeType newLast = parseDate(lastStr);
-        timeType newNext = parseDate(nextStr);
-        aircraft->updateMaintenanceSchedule(newLast, newNext);
-
-        // --- Update JSON file after logging maintenance
-        nlohmann::json jArray = nlohmann::json::array();
-        for (auto& craft : aircrafts) {
-            jArray.push_back(craft->getAircraftJson());
-        }
-        std::ofstream outFile("database/Aircrafts.json");
-        outFile << jArray.dump(4);
+        OpResult result = logMaintenance(aircraft->getModel(), parseDate(lastStr), parseDate(nextStr));
+        if (!result.ok) throw std::runtime_error(result.error);
         std::cout << "Maintenance logged successfully.\n";
     }
     catch (const std::exception& e) {
@@ -221,31 +300,62 @@ void AircraftsSystem::logMaintenance() {
     }
 }
 
+// ---------------------------- Headless API ---------------------------- //
+std::shared_ptr<Aircraft> AircraftsSystem::getAircraftByModel(const std::string& model) const {
+    auto symbol = strings().find(model);
+    return symbol ? getAircraftByModel(*symbol) : nullptr;
+}
+
+// --- Integer compare per aircraft (models are interned) :
+std::shared_ptr<Aircraft> AircraftsSystem::getAircraftByModel(Symbol model) const {
+    for (const auto& aircraft : aircrafts) {
+        if (aircraft->getModelId() == model) return aircraft;
+    }
+    return nullptr;
+}
+
+OpResult AircraftsSystem::addAircraft(const std::string& model, int capacity) {
+    if (model.empty()) return OpResult::failure("Aircraft model cannot be empty.");
+    if (capacity <= 0) return OpResult::failure("Aircraft capacity must be positive.");
+    if (getAircraftByModel(model)) return OpResult::failure("Aircraft model already exists.");
+
+    aircrafts.push_back(std::make_shared<Aircraft>(model, capacity));
+    saveAircrafts();
+    return OpResult::success();
+}
+
+OpResult AircraftsSystem::removeAircraft(const std::string& model) {
+    auto symbol = strings().find(model);
+    auto it = !symbol ? aircrafts.end() : std::find_if(aircrafts.begin(), aircrafts.end(),
+        [&symbol](const std::shared_ptr<Aircraft>& a) { return a->getModelId() == *symbol; });
+    if (it == aircrafts.end()) return OpResult::failure("Aircraft model not found.");
+
+    aircrafts.erase(it);
+    saveAircrafts();
+    return OpResult::success();
+}
+
+OpResult AircraftsSystem::logMaintenance(const std::string& model, const timeType& last, const timeType& next) {
+    auto aircraft = getAircraftByModel(model);
+    if (!aircraft) return OpResult::failure("Aircraft model not found.");
+    if (last < aircraft->getLastMaintenance() || last > next)
+        return OpResult::failure("Incorrect new maintenance schedule");
+
+    aircraft->updateMaintenanceSchedule(last, next);
+    saveAircrafts();
+    return OpResult::success();
+}
+
 
 // =========================================   Crew Class functions   ======================================= //
 
 Crew::Crew(int id, const std::string& name, const std::string& role, double totalFlightHours): 
-    crewID(id), name(name), role(role), totalFlightHours(totalFlightHours){}
+    crewID(id), name(name), role(intern(role)), totalFlightHours(totalFlightHours){}
 
 // Default constructor loading crew data
 Crew::Crew(){
-    std::ifstream crewfile("database/Crew.json");
-    if (!crewfile.is_open()) {
-        throw std::runtime_error("Could not open Crew.json");
-    }
-
-    nlohmann::json j;
-    crewfile >> j; // Read the full JSON array from file
-
-    // Iterate over each aircraft entry in the JSON array
-    for (const auto& item : j) {
-        int crewID                   = item["crewID"];
-        std::string name             = item["name"];
-        std::string role             = item["role"];
-        double totalFlightHours      = item["totalFlightHours"];
-
-        // Create Aircraft object and add to aircrafts vector
-        crewmembers.push_back(std::make_shared<Crew>(crewID,name, role, totalFlightHours));
+    for (const auto& r : loadCrewRecords("database/Crew.json")) {
+        crewmembers.push_back(std::make_shared<Crew>(r.crewID, r.name, r.role, r.totalFlightHours));
     }
 }
 
@@ -265,6 +375,14 @@ void Crew::assignToFlight(int flightHours){
     }
 }
 
+void Crew::restoreFlight(int flightHours){
+    totalFlightHours += flightHours;
+}
+
+void Crew::releaseFlight(int flightHours){
+    totalFlightHours = std::max(0.0, totalFlightHours - flightHours);
+}
+
 void Crew::displayCrewInfo() const{
     std::cout<< "---- Crew Info ----" <<std::endl; 
     std::cout<< "Crew member name: " << name <<std::endl;
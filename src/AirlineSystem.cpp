@@ -1,9 +1,27 @@
 #include "AirlineSystem.hpp"
-
-// Constructor
+#include "Server.hpp"
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <limits>
+#include <sstream>
+
+#if defined(_WIN32)
+    #include <conio.h>
+#else
+    #include <termios.h>
+    #include <unistd.h>
+#endif
+
+// Constructor: all tables are parsed in parallel first, then each system is linked from them in order
 AirlineSystem::AirlineSystem() 
-    :userSystem(), flightSystem(), reservationSystem(flightSystem, userSystem), 
-     checkinSystem(reservationSystem) {}
+    :boot(std::make_unique<Bootstrap>()), userSystem(boot->link("users")), aircraftSystem(boot->link("aircraft")),
+     flightSystem(aircraftSystem, boot->link("flights")), reservationSystem(flightSystem, userSystem, boot->link("reservations")), 
+     checkinSystem(reservationSystem, flightSystem) {
+    boot->finish();
+    boot->report(std::cout);
+    boot.reset();
+}
 
 AirlineSystem::~AirlineSystem() {
     std::cout << "Destroying AirlineSystem\n";
@@ -32,18 +50,46 @@ Reservation::~Reservation() {
 
 
 // ------------------------------- Hash Password ------------------------------- //
+namespace {
+    // --- One key, unechoed: _getch on Windows, a non-canonical termios read elsewhere.
+    //     Enter comes back as '\r' and backspace as '\b' on both; end of input reads as Enter :
+    int getch() {
+    #if defined(_WIN32)
+        return _getch();
+    #else
+        termios saved;
+        const bool terminal = tcgetattr(STDIN_FILENO, &saved) == 0;
+        if (terminal) {
+            termios raw = saved;
+            raw.c_lflag &= ~(ICANON | ECHO);
+            raw.c_iflag &= ~ICRNL;
+            raw.c_cc[VMIN] = 1;
+            raw.c_cc[VTIME] = 0;
+            tcsetattr(STDIN_FILENO, TCSANOW, &raw);
+        }
+        const int ch = std::getchar();
+        if (terminal) tcsetattr(STDIN_FILENO, TCSANOW, &saved);
+        if (ch == EOF) return '\r';
+        if (ch == 127) return '\b';
+        return ch;
+    #endif
+    }
+}
+
 std::string getPasswordInput() {
     std::string password;
-    char ch;
-    std::cout << "Enter password: ";
-    while ((ch = _getch()) != '\r') { // Enter key
+    int ch;
+    std::cout << "Enter password: " << std::flush;
+    // A newline before any key is the end of the email line std::cin left unread
+    while ((ch = getch()) != '\r' && !(ch == '\n' && !password.empty())) { // Enter key
+        if (ch == '\n') continue;
         if (ch == '\b') { // Backspace
             if (!password.empty()) {
                 password.pop_back();
                 std::cout << "\b \b";
             }
         } else {
-            password += ch;
+            password += static_cast<char>(ch);
             std::cout << '*';
         }
     }
@@ -163,9 +209,9 @@ void AirlineSystem::admin_GenerateReports() {
         std::cin >> choice;
 
         switch (choice) {
-            case 1: logSystem.generateOperationalReport(); break;   //total flights, total reservations
+            case 1: logSystem.generateOperationalReport(flightSystem); break;   //total flights, total reservations
             case 2: logSystem.generateMaintenanceReport(); break;   // aircraft status, maintenance schedules
-            case 3: logSystem.generateUserActivityReport(); break;  // user flight bookings
+            case 3: logSystem.generateUserActivityReport(flightSystem, reservationSystem); break;  // user flight bookings
             case 4: return;
             default: std::cout << "Invalid choice. Please try again.\n";
         }
@@ -215,6 +261,65 @@ void AirlineSystem::agent_ModifyBooking() {
     reservationSystem.modifyBooking();
 }
 
+// ---------- Agent Group Check-in (a whole flight or a list of reservations, one journal write) ---------- //
+void AirlineSystem::agent_GroupCheckIn() {
+    std::cout << "1. Whole flight\n"
+              << "2. List of reservation IDs\n"
+              << "Enter choice: ";
+    int choice;
+    std::cin >> choice;
+    if (choice == 1) {
+        std::cout << "Enter flight number: ";
+        int flightNumber;
+        std::cin >> flightNumber;
+        checkinSystem.flightCheckIn(flightNumber);
+    } else if (choice == 2) {
+        std::cout << "Enter reservation IDs separated by spaces: ";
+        std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+        std::string line;
+        std::getline(std::cin, line);
+        std::istringstream in(line);
+        std::vector<int> ids;
+        for (int id; in >> id;) ids.push_back(id);
+        checkinSystem.groupCheckIn(ids);
+    } else {
+        std::cout << "Invalid choice.\n";
+    }
+}
+
+// ---------- Agent Print Boarding Passes (every checked-in passenger of a flight, one file write) ---------- //
+void AirlineSystem::agent_PrintBoardingPasses() {
+    int flightNumber, formatChoice;
+    std::cout << "Enter flight number: ";
+    std::cin >> flightNumber;
+    std::cout << "Format (1. Text  2. JSON  3. Printable): ";
+    std::cin >> formatChoice;
+    if (formatChoice < 1 || formatChoice > 3) {
+        std::cout << "Invalid format.\n";
+        return;
+    }
+    const PassFormat format = static_cast<PassFormat>(formatChoice - 1);
+    const std::string path = "BoardingPasses_" + std::to_string(flightNumber) + "." + passFormatExtension(format);
+
+    const auto start = std::chrono::steady_clock::now();
+    std::ofstream file(path, std::ios::binary);
+    if (!file) {
+        std::cout << "Error: cannot write " << path << "\n";
+        return;
+    }
+    std::size_t printed = checkinSystem.printBoardingPasses(flightNumber, format, file);
+    file.close();
+    const double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    if (printed == 0) {
+        std::remove(path.c_str());
+        std::cout << "No boarding passes for flight " << flightNumber << " (unknown flight or nobody checked in).\n";
+        return;
+    }
+    std::cout << printed << " " << passFormatName(format) << " boarding pass" << (printed == 1 ? "" : "es")
+              << " written to " << path << " in " << ms << " ms.\n";
+}
+
 // ========================== AGENT LOOP ========================== //
 void AirlineSystem::agentLoop() {
     int choice;
@@ -223,7 +328,9 @@ void AirlineSystem::agentLoop() {
                   << "1. Book Flight\n"
                   << "2. Remove Booking\n"
                   << "3. Modify Booking\n"
-                  << "4. Logout\n"
+                  << "4. Group Check-in\n"
+                  << "5. Print Boarding Passes\n"
+                  << "6. Logout\n"
                   << "Enter your choice: ";
         std::cin >> choice;
 
@@ -231,10 +338,12 @@ void AirlineSystem::agentLoop() {
             case 1: agent_BookFlight();  break;
             case 2:  agent_RemoveBooking(); break;
             case 3:  agent_ModifyBooking();  break;
-            case 4: std::cout << "Logging out...\n"; break;
+            case 4:  agent_GroupCheckIn();  break;
+            case 5:  agent_PrintBoardingPasses();  break;
+            case 6: std::cout << "Logging out...\n"; break;
             default: std::cout << "Invalid choice. Please try again.\n";
         }
-    } while (choice != 4);
+    } while (choice != 6);
 
     userLoop();
 }
@@ -305,3 +414,9 @@ void AirlineSystem::userLoop() {
         default: break;
     }
 }
+
+// ============================================== SERVE MODE ================================= //
+void AirlineSystem::serve(int port, int workers) {
+    BookingServer server(flightSystem, reservationSystem, port, workers);
+    server.run();
+}
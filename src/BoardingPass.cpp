@@ -0,0 +1,186 @@
+#include "../Include/BoardingPass.hpp"
+#include "../Include/Flight.hpp"
+#include <algorithm>
+#include <charconv>
+
+namespace {
+    const std::size_t boxInner = 36;            // printable: "| " + 36 columns + " |"
+    const std::size_t labelWidth = 11;
+    const char* const boxEdge = "+--------------------------------------+\n";
+
+    // --- "| Label      value                     |", value cut to fit and control characters (a tab or
+    //     newline in a name) blanked so the box stays one row; a null label gives one full-width cell :
+    void appendBoxRow(std::string& out, const char* label, const char* value, std::size_t length) {
+        out += "| ";
+        std::size_t width = boxInner;
+        if (label) {
+            const std::size_t labelLength = std::char_traits<char>::length(label);
+            out.append(label, labelLength);
+            out.append(labelWidth - labelLength, ' ');
+            width -= labelWidth;
+        }
+        const std::size_t shown = std::min(length, width);
+        for (std::size_t i = 0; i < shown; i++) out += static_cast<unsigned char>(value[i]) < 0x20 ? ' ' : value[i];
+        out.append(width - shown, ' ');
+        out += " |\n";
+    }
+
+    void appendBoxRow(std::string& out, const char* label, const std::string& value) {
+        appendBoxRow(out, label, value.data(), value.size());
+    }
+}
+
+// ===================================== BoardingPassRenderer Class ===================================== //
+
+void BoardingPassRenderer::setFlight(int number, const std::string& from, const std::string& to, const timeType& departure) {
+    flightNumber = std::to_string(number);
+    origin = from;
+    destination = to;
+    boardingTime = formatDateTime(departure);
+
+    printableRoute.clear();
+    appendBoxRow(printableRoute, "Flight", flightNumber);
+    appendBoxRow(printableRoute, "From", origin);
+    appendBoxRow(printableRoute, "To", destination);
+    printableBoarding.clear();
+    appendBoxRow(printableBoarding, "Boarding", boardingTime);
+}
+
+void BoardingPassRenderer::setFlight(const Flight& flight) {
+    setFlight(flight.getFlightNo(), flight.getOrigin(), flight.getDestination(), flight.getDepartureTime());
+}
+
+// --- Upper bound for one pass with a name of up to 32 bytes; longer names just grow the buffer :
+std::size_t BoardingPassRenderer::estimatedPassSize() const {
+    const std::size_t flightFields = flightNumber.size() + origin.size() + destination.size() + boardingTime.size();
+    switch (format) {
+        case PassFormat::json:      return 128 + 32 + flightFields;
+        case PassFormat::printable: return 10 * 41 + 2;
+        default:                    return 112 + 32 + flightFields;
+    }
+}
+
+void BoardingPassRenderer::reserve(std::size_t passCount) {
+    buffer.reserve(buffer.size() + passCount * estimatedPassSize());
+}
+
+void BoardingPassRenderer::clear() {
+    buffer.clear();
+    passes = 0;
+}
+
+void BoardingPassRenderer::appendInt(int value) {
+    char digits[16];
+    auto end = std::to_chars(digits, digits + sizeof digits, value).ptr;
+    buffer.append(digits, end);
+}
+
+void BoardingPassRenderer::appendJsonString(const std::string& text) {
+    static const char hex[] = "0123456789abcdef";
+    buffer += '"';
+    for (char ch : text) {
+        const unsigned char c = static_cast<unsigned char>(ch);
+        if (c == '"' || c == '\\') {
+            buffer += '\\';
+            buffer += ch;
+        } else if (c < 0x20) {
+            buffer += "\\u00";
+            buffer += hex[c >> 4];
+            buffer += hex[c & 0xF];
+        } else {
+            buffer += ch;
+        }
+    }
+    buffer += '"';
+}
+
+void BoardingPassRenderer::add(const std::string& passengerName, int seatNumber, int reservationId) {
+    switch (format) {
+        case PassFormat::json:
+            buffer += "{\"reservationId\":";
+            appendInt(reservationId);
+            buffer += ",\"passenger\":";
+            appendJsonString(passengerName);
+            buffer += ",\"flightNumber\":";
+            buffer += flightNumber;
+            buffer += ",\"origin\":";
+            appendJsonString(origin);
+            buffer += ",\"destination\":";
+            appendJsonString(destination);
+            buffer += ",\"seat\":";
+            appendInt(seatNumber);
+            buffer += ",\"boardingTime\":\"";
+            buffer += boardingTime;
+            buffer += "\"}\n";
+            break;
+
+        case PassFormat::printable: {
+            char seat[16], barcode[48];                 // Code 39 payload "*R<id>-F<flight>-S<seat>*", start/stop '*'
+            const std::size_t seatLength = std::to_chars(seat, seat + sizeof seat, seatNumber).ptr - seat;
+            char* code = barcode;
+            *code++ = '*';
+            *code++ = 'R';
+            code = std::to_chars(code, barcode + sizeof barcode, reservationId).ptr;
+            *code++ = '-';
+            *code++ = 'F';
+            code = std::copy(flightNumber.begin(), flightNumber.end(), code);
+            *code++ = '-';
+            *code++ = 'S';
+            code = std::copy(seat, seat + seatLength, code);
+            *code++ = '*';
+            if (passes > 0) buffer += '\f';
+            buffer += boxEdge;
+            buffer += "| BOARDING PASS                        |\n";
+            appendBoxRow(buffer, "Passenger", passengerName);
+            buffer += printableRoute;
+            appendBoxRow(buffer, "Seat", seat, seatLength);
+            buffer += printableBoarding;
+            appendBoxRow(buffer, nullptr, barcode, code - barcode);
+            buffer += boxEdge;
+            break;
+        }
+
+        default:
+            buffer += "\n--- Boarding Pass ---\nPassenger: ";
+            buffer += passengerName;
+            buffer += "\nFlight Number: ";
+            buffer += flightNumber;
+            buffer += "\nFrom: ";
+            buffer += origin;
+            buffer += "\nTo: ";
+            buffer += destination;
+            buffer += "\nSeat: ";
+            appendInt(seatNumber);
+            buffer += "\nBoarding Time: ";
+            buffer += boardingTime;
+            buffer += "\n---------------------\n";
+    }
+    passes++;
+}
+
+std::size_t BoardingPassRenderer::renderManifest(const Flight& flight, const std::vector<ManifestEntry>& manifest, bool checkedInOnly) {
+    setFlight(flight);
+    reserve(manifest.size());
+    const std::size_t before = passes;
+    for (const auto& entry : manifest) {
+        if (checkedInOnly && !entry.checkedIn) continue;
+        add(entry.passengerName, entry.seatNumber, entry.reservationId);
+    }
+    return passes - before;
+}
+
+const char* passFormatName(PassFormat format) {
+    switch (format) {
+        case PassFormat::json:      return "json";
+        case PassFormat::printable: return "printable";
+        default:                    return "text";
+    }
+}
+
+const char* passFormatExtension(PassFormat format) {
+    switch (format) {
+        case PassFormat::json:      return "jsonl";
+        case PassFormat::printable: return "prn";
+        default:                    return "txt";
+    }
+}
@@ -0,0 +1,139 @@
+#include "../Include/Bootstrap.hpp"
+#include "../Include/RecordStream.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <exception>
+#include <functional>
+
+namespace {
+    // --- Runs every task once on min(threads, tasks) workers; rethrows the first failure after all joined :
+    void runOnPool(const std::vector<std::function<void()>>& tasks, unsigned threads) {
+        std::atomic<std::size_t> next{0};
+        std::vector<std::exception_ptr> errors(tasks.size());
+        auto worker = [&] {
+            for (std::size_t i = next++; i < tasks.size(); i = next++) {
+                try {
+                    tasks[i]();
+                } catch (...) {
+                    errors[i] = std::current_exception();
+                }
+            }
+        };
+
+        std::vector<std::thread> pool;
+        for (unsigned t = 1; t < threads && t < tasks.size(); t++) pool.emplace_back(worker);
+        worker();                   // the calling thread is one of the workers
+        for (auto& thread : pool) thread.join();
+
+        for (const auto& error : errors) {
+            if (error) std::rethrow_exception(error);
+        }
+    }
+
+    double msSince(std::chrono::steady_clock::time_point start) {
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    }
+}
+
+// ===================================== Bootstrap Class ===================================== //
+
+// ------ Parse phase : one task per table, each filling its own vector ------ //
+Bootstrap::Bootstrap(unsigned threads) {
+    const auto started = clock::now();
+    std::unique_ptr<SnapshotView> snapshot = openFreshSnapshot();
+    source = snapshot ? "snapshot" : "JSON";
+    const SnapshotView* view = snapshot.get();
+
+    // From JSON, reservations (the table that grows with use) are not held as records: the link step
+    // streams them straight into ReservationSystem, so memory stays bounded by one row (RecordStream.hpp)
+    if (!view) streamed.push_back("reservations");
+
+    auto file = [](SnapshotSource table) { return std::string(snapshotSourceFiles[static_cast<int>(table)]); };
+    struct Parse {
+        const char* name;
+        std::function<void()> run;
+    };
+    // Largest tables first, so a short one never holds up the pool's last worker
+    std::vector<Parse> parses;
+    if (view) {
+        parses.push_back({"reservations", [&, view] { tables.reservations = view->reservationRecords(); }});
+    }
+    parses.push_back({"flights", [&, view] {
+        tables.flights = view ? view->flightRecords() : loadFlightRecords(file(SnapshotSource::flights), consoleProgress("flights"));
+    }});
+    parses.push_back({"users", [&, view] {
+        tables.users = view ? view->userRecords() : loadUserRecords(file(SnapshotSource::users), consoleProgress("users"));
+    }});
+    parses.push_back({"crew", [&, view] {
+        tables.crew = view ? view->crewRecords() : loadCrewRecords(file(SnapshotSource::crew), consoleProgress("crew"));
+    }});
+    parses.push_back({"aircraft", [&, view] {
+        tables.aircrafts = view ? view->aircraftRecords() : loadAircraftRecords(file(SnapshotSource::aircraft), consoleProgress("aircraft"));
+    }});
+
+    threadsUsed = std::max(1u, std::min(threads, static_cast<unsigned>(parses.size())));
+    parseSteps.resize(parses.size());
+    std::vector<std::function<void()>> tasks;
+    for (std::size_t i = 0; i < parses.size(); i++) {
+        parseSteps[i].name = parses[i].name;
+        tasks.push_back([this, i, &parses] {
+            const auto start = clock::now();
+            parses[i].run();
+            parseSteps[i].ms = msSince(start);
+        });
+    }
+    runOnPool(tasks, threadsUsed);
+    parseMs = msSince(started);
+}
+
+// ------ Link phase : the caller builds one system per step from the parsed tables ------ //
+void Bootstrap::closeStep() {
+    if (linking) linkSteps.back().ms = msSince(stepStarted);
+}
+
+const SnapshotData* Bootstrap::link(const std::string& step) {
+    closeStep();
+    stepStarted = clock::now();
+    if (!linking) linkStarted = stepStarted;
+    linking = true;
+    linkSteps.push_back({step, 0});
+    if (std::find(streamed.begin(), streamed.end(), step) != streamed.end()) return nullptr;
+    return &tables;
+}
+
+void Bootstrap::finish() {
+    closeStep();
+    linking = false;
+    tables = SnapshotData();        // the systems hold their own copies now
+}
+
+double Bootstrap::linkMilliseconds() const {
+    double total = 0;
+    for (const auto& step : linkSteps) total += step.ms;
+    return total;
+}
+
+// ------ "Startup (JSON, 4 threads): parse ... | link ... | total ..." ------ //
+void Bootstrap::report(std::ostream& out) const {
+    auto steps = [](const std::vector<Step>& list) {
+        std::string text;
+        char buffer[64];
+        for (const auto& step : list) {
+            std::snprintf(buffer, sizeof buffer, "%s%s %.1f", text.empty() ? "" : ", ", step.name.c_str(), step.ms);
+            text += buffer;
+        }
+        return text;
+    };
+    char line[96];
+    std::snprintf(line, sizeof line, "Startup (%s, %u thread%s)", source.c_str(), threadsUsed, threadsUsed == 1 ? "" : "s");
+    out << line;
+    for (std::size_t i = 0; i < streamed.size(); i++) out << (i == 0 ? ", streamed while linking: " : ", ") << streamed[i];
+    out << ":\n";
+    std::snprintf(line, sizeof line, "  parse %9.1f ms  [", parseMs);
+    out << line << steps(parseSteps) << "]\n";
+    std::snprintf(line, sizeof line, "  link  %9.1f ms  [", linkMilliseconds());
+    out << line << steps(linkSteps) << "]\n";
+    std::snprintf(line, sizeof line, "  total %9.1f ms\n", parseMs + linkMilliseconds());
+    out << line;
+}
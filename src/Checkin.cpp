@@ -2,39 +2,47 @@
 
 
 bool CheckinSystem::airportCheckIn(int reservationId) {
- std::ifstream file("Database/Reservations.json");
-    if (!file.is_open()) {
-        std::cout << "Could not open reservation.json file.\n";
+    // State is kept on the Reservation; the change is journaled instead of rewriting Reservations.json
+    CheckInResult result = reservationSystem.checkIn({reservationId});
+    if (!result.notFound.empty()) {
+        std::cout << "Reservation ID " << reservationId << " not found.\n";
         return false;
     }
+    if (!result.alreadyCheckedIn.empty())
+        std::cout << "Reservation ID " << reservationId << " is already checked in.\n";
+    else
+        std::cout << "Airport check-in completed for reservation ID: " << reservationId << std::endl;
+    return true;
+}
 
-    nlohmann::json reservationsJson;
-    file >> reservationsJson;
-    file.close();
-
-    bool updated = false;
-    for (auto& res : reservationsJson) {
-        if (res["reservationId"] == reservationId) {
-            res["checkIn"] = "checked In";
-            updated = true;
-            break;
+namespace {
+    void printCheckInSummary(const CheckInResult& result) {
+        std::cout << "Checked in: " << result.checkedIn.size()
+                  << " | Already checked in: " << result.alreadyCheckedIn.size()
+                  << " | Not found: " << result.notFound.size() << "\n";
+        if (!result.notFound.empty()) {
+            std::cout << "Unknown reservation IDs:";
+            for (int id : result.notFound) std::cout << " " << id;
+            std::cout << "\n";
         }
     }
+}
 
-    if (updated) {
-        std::ofstream outFile("Database/Reservations.json");
-        outFile << reservationsJson.dump(4);
-        outFile.close();
-        std::cout << "Airport check-in completed for reservation ID: " << reservationId << std::endl;
-        return true;
-    } else {
-        std::cout << "Reservation ID " << reservationId << " not found.\n";
-        return false;
-    }
+CheckInResult CheckinSystem::groupCheckIn(const std::vector<int>& reservationIds) {
+    CheckInResult result = reservationSystem.checkIn(reservationIds);
+    printCheckInSummary(result);
+    return result;
+}
+
+CheckInResult CheckinSystem::flightCheckIn(int flightNumber) {
+    CheckInResult result = reservationSystem.checkInFlight(flightNumber);
+    std::cout << "Flight " << flightNumber << ": ";
+    printCheckInSummary(result);
+    return result;
 }
 
 void CheckinSystem::generateBoardingPass(int reservationId) const {
-    auto reservation = reservationSystem.getReservationById(reservationId);
+    Reservation* reservation = reservationSystem.findReservation(reservationId);
 
     if (!reservation) {
         std::cout << "Reservation ID " << reservationId << " not found.\n";
@@ -49,37 +57,30 @@ void CheckinSystem::generateBoardingPass(int reservationId) const {
         return;
 }
 
-    std::cout << "\n--- Boarding Pass ---\n";
-    std::cout << "Passenger: " << passenger->getUserName() << "\n";
-    std::cout << "Flight Number: " << flight->getFlightNo() << "\n";
-    std::cout << "From: " << flight->getOrigin() << "\n";
-    std::cout << "To: " << flight->getDestination() << "\n";
-    std::cout << "Seat: " << reservation->getSeatNo() << "\n";
-    std::cout << "Boarding Time: " << formatDateTime(flight->getDepartureTime()) << "\n";
-    std::cout << "---------------------\n";
+    BoardingPassRenderer renderer;
+    renderer.setFlight(*flight);
+    renderer.add(passenger->getUserName(), reservation->getSeatNo(), reservationId);
+    renderer.writeTo(std::cout);
+}
+
+std::size_t CheckinSystem::printBoardingPasses(int flightNumber, PassFormat format, std::ostream& out) const {
+    auto flight = flightSystem.getFlightByNumber(flightNumber);
+    if (!flight) return 0;
+    BoardingPassRenderer renderer(format);
+    std::size_t printed = renderer.renderManifest(*flight, reservationSystem.getManifest(flightNumber));
+    renderer.writeTo(out);
+    return printed;
 }
 
 void CheckinSystem::displayCheckinStatus(int reservationId) const {
-    auto reservation = reservationSystem.getReservationById(reservationId);
-    std::ifstream file("Database/Reservations.json");
-    if (!file.is_open()) {
-        std::cout << "Could not open reservation.json file.\n";
+    Reservation* reservation = reservationSystem.findReservation(reservationId);
+    if (!reservation || !reservation->getFlight()) {
+        std::cout << "Reservation ID " << reservationId << " not found.\n";
         return;
     }
-
-    nlohmann::json reservationsJson;
-    file >> reservationsJson;
-    file.close();
-
-    for (const auto& res : reservationsJson) {
-        if (res["reservationId"] == reservationId) {
-            std::cout << "Check-in status for reservation ID " << reservationId << ":\n";
-            std::cout << "  Status: Checked In\n";
-            std::cout << "  Seat: " << reservation->getSeatNo() << "\n";
-            std::cout << "  Flight Number: " << reservation->flight->getFlightNo() << "\n";
-            std::cout << "  Boarding Time: " << formatDateTime(reservation->flight->getDepartureTime()) << "\n";
-            return;
-        }
-    }
-    std::cout << "Reservation ID " << reservationId << " not found.\n";
-}
\ No newline at end of file
+    std::cout << "Check-in status for reservation ID " << reservationId << ":\n";
+    std::cout << "  Status: " << (reservation->isCheckedIn() ? "Checked In" : "Not checked in") << "\n";
+    std::cout << "  Seat: " << reservation->getSeatNo() << "\n";
+    std::cout << "  Flight Number: " << reservation->getFlight()->getFlightNo() << "\n";
+    std::cout << "  Boarding Time: " << formatDateTime(reservation->getFlight()->getDepartureTime()) << "\n";
+}
@@ -0,0 +1,198 @@
+#include "../Include/FilterKernel.hpp"
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define FILTER_KERNEL_X86 1
+#include <immintrin.h>
+#else
+#define FILTER_KERNEL_X86 0
+#endif
+
+namespace {
+
+// ------ Scalar : one branch-free test per row ------ //
+inline unsigned rowPasses(const FilterColumns& c, const FilterPredicate& p, std::size_t i) {
+    return (static_cast<unsigned>(c.origins[i] == p.origin) | p.anyOrigin)
+         & (static_cast<unsigned>(c.destinations[i] == p.destination) | p.anyDestination)
+         & (static_cast<unsigned>(p.statusMask >> c.statuses[i]) & 1u)
+         & static_cast<unsigned>(c.departureDays[i] >= p.firstDay)
+         & static_cast<unsigned>(c.departureDays[i] <= p.lastDay)
+         & static_cast<unsigned>(c.departureMinutes[i] >= p.departsFrom)
+         & static_cast<unsigned>(c.departureMinutes[i] <= p.departsUntil)
+         & static_cast<unsigned>(c.seatsFree[i] >= p.minSeatsFree);
+}
+
+// --- Bits for rows [first, last), at most 64 of them :
+inline std::uint64_t scalarWord(const FilterColumns& c, const FilterPredicate& p, std::size_t first, std::size_t last) {
+    std::uint64_t word = 0;
+    for (std::size_t i = first; i < last; i++) word |= static_cast<std::uint64_t>(rowPasses(c, p, i)) << (i - first);
+    return word;
+}
+
+// --- Full words test 64 rows into a flag array first. With the predicate in locals and a fixed
+//     trip count (no scalar tail) -O2's vectorizer takes the test loop, so even this version gets
+//     the compiler's baseline SIMD for all but the status lookup :
+void filterScalar(const FilterColumns& c, const FilterPredicate& p, std::size_t rows, std::uint64_t* words) {
+    const std::uint32_t* origins = c.origins;
+    const std::uint32_t* destinations = c.destinations;
+    const std::int32_t* minutes = c.departureMinutes;
+    const std::int32_t* days = c.departureDays;
+    const std::uint8_t* statuses = c.statuses;
+    const std::int32_t* seats = c.seatsFree;
+    const std::uint32_t origin = p.origin, destination = p.destination;
+    const unsigned anyOrigin = p.anyOrigin, anyDestination = p.anyDestination, statusMask = p.statusMask;
+    const std::int32_t firstDay = p.firstDay, lastDay = p.lastDay;
+    const std::int32_t departsFrom = p.departsFrom, departsUntil = p.departsUntil, minSeats = p.minSeatsFree;
+
+    const std::size_t fullWords = rows / 64;
+    unsigned pass[64];
+    for (std::size_t w = 0; w < fullWords; w++) {
+        const std::size_t base = w * 64;
+        for (std::size_t j = 0; j < 64; j++) {
+            const std::size_t i = base + j;
+            pass[j] = (static_cast<unsigned>(origins[i] == origin) | anyOrigin)
+                    & (static_cast<unsigned>(destinations[i] == destination) | anyDestination)
+                    & static_cast<unsigned>(days[i] >= firstDay)
+                    & static_cast<unsigned>(days[i] <= lastDay)
+                    & static_cast<unsigned>(minutes[i] >= departsFrom)
+                    & static_cast<unsigned>(minutes[i] <= departsUntil)
+                    & static_cast<unsigned>(seats[i] >= minSeats);
+        }
+        std::uint64_t word = 0;
+        for (std::size_t j = 0; j < 64; j++) word |= static_cast<std::uint64_t>(pass[j] & (statusMask >> statuses[base + j])) << j;
+        words[w] = word;
+    }
+    if (rows % 64) words[fullWords] = scalarWord(c, p, fullWords * 64, rows);
+}
+
+#if FILTER_KERNEL_X86
+
+// ------ SSE4.1 : 4 rows per compare. Statuses go 16 at a time through a pshufb lookup table whose
+//        byte s is 0xFF when status s is wanted, so the status mask costs one shuffle per 16 rows ------ //
+__attribute__((target("sse4.1")))
+void filterSse41(const FilterColumns& c, const FilterPredicate& p, std::size_t rows, std::uint64_t* words) {
+    const __m128i origin = _mm_set1_epi32(static_cast<int>(p.origin));
+    const __m128i destination = _mm_set1_epi32(static_cast<int>(p.destination));
+    const __m128i anyOrigin = _mm_set1_epi32(p.anyOrigin ? -1 : 0);
+    const __m128i anyDestination = _mm_set1_epi32(p.anyDestination ? -1 : 0);
+    const __m128i firstDay = _mm_set1_epi32(p.firstDay), lastDay = _mm_set1_epi32(p.lastDay);
+    const __m128i departsFrom = _mm_set1_epi32(p.departsFrom), departsUntil = _mm_set1_epi32(p.departsUntil);
+    const __m128i minSeats = _mm_set1_epi32(p.minSeatsFree);
+    alignas(16) std::uint8_t table[16] = {};
+    for (int s = 0; s < 8; s++) table[s] = (p.statusMask >> s) & 1 ? 0xFF : 0;
+    const __m128i statusTable = _mm_load_si128(reinterpret_cast<const __m128i*>(table));
+
+    const std::size_t fullWords = rows / 64;
+    for (std::size_t w = 0; w < fullWords; w++) {
+        const std::size_t base = w * 64;
+        std::uint64_t statusBits = 0;
+        for (std::size_t k = 0; k < 64; k += 16) {
+            __m128i status = _mm_loadu_si128(reinterpret_cast<const __m128i*>(c.statuses + base + k));
+            statusBits |= static_cast<std::uint64_t>(_mm_movemask_epi8(_mm_shuffle_epi8(statusTable, status))) << k;
+        }
+        std::uint64_t rowBits = 0;
+        for (std::size_t k = 0; k < 64; k += 4) {
+            const std::size_t i = base + k;
+            __m128i days = _mm_loadu_si128(reinterpret_cast<const __m128i*>(c.departureDays + i));
+            __m128i minutes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(c.departureMinutes + i));
+            __m128i seats = _mm_loadu_si128(reinterpret_cast<const __m128i*>(c.seatsFree + i));
+            __m128i route = _mm_and_si128(
+                _mm_or_si128(_mm_cmpeq_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(c.origins + i)), origin), anyOrigin),
+                _mm_or_si128(_mm_cmpeq_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(c.destinations + i)), destination), anyDestination));
+            __m128i outside = _mm_or_si128(_mm_or_si128(_mm_cmplt_epi32(days, firstDay), _mm_cmpgt_epi32(days, lastDay)),
+                                           _mm_or_si128(_mm_cmplt_epi32(minutes, departsFrom), _mm_cmpgt_epi32(minutes, departsUntil)));
+            outside = _mm_or_si128(outside, _mm_cmplt_epi32(seats, minSeats));
+            __m128i pass = _mm_andnot_si128(outside, route);
+            rowBits |= static_cast<std::uint64_t>(_mm_movemask_ps(_mm_castsi128_ps(pass))) << k;
+        }
+        words[w] = rowBits & statusBits;
+    }
+    if (rows % 64) words[fullWords] = scalarWord(c, p, fullWords * 64, rows);
+}
+
+// ------ AVX2 : the same test, 8 rows per compare and 32 statuses per shuffle ------ //
+__attribute__((target("avx2")))
+void filterAvx2(const FilterColumns& c, const FilterPredicate& p, std::size_t rows, std::uint64_t* words) {
+    const __m256i origin = _mm256_set1_epi32(static_cast<int>(p.origin));
+    const __m256i destination = _mm256_set1_epi32(static_cast<int>(p.destination));
+    const __m256i anyOrigin = _mm256_set1_epi32(p.anyOrigin ? -1 : 0);
+    const __m256i anyDestination = _mm256_set1_epi32(p.anyDestination ? -1 : 0);
+    // AVX2 has no signed less-than, so a < b is written b > a
+    const __m256i firstDay = _mm256_set1_epi32(p.firstDay), lastDay = _mm256_set1_epi32(p.lastDay);
+    const __m256i departsFrom = _mm256_set1_epi32(p.departsFrom), departsUntil = _mm256_set1_epi32(p.departsUntil);
+    const __m256i minSeats = _mm256_set1_epi32(p.minSeatsFree);
+    alignas(16) std::uint8_t table[16] = {};
+    for (int s = 0; s < 8; s++) table[s] = (p.statusMask >> s) & 1 ? 0xFF : 0;
+    const __m256i statusTable = _mm256_broadcastsi128_si256(_mm_load_si128(reinterpret_cast<const __m128i*>(table)));
+
+    const std::size_t fullWords = rows / 64;
+    for (std::size_t w = 0; w < fullWords; w++) {
+        const std::size_t base = w * 64;
+        std::uint64_t statusBits = 0;
+        for (std::size_t k = 0; k < 64; k += 32) {
+            __m256i status = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(c.statuses + base + k));
+            statusBits |= static_cast<std::uint64_t>(static_cast<std::uint32_t>(
+                _mm256_movemask_epi8(_mm256_shuffle_epi8(statusTable, status)))) << k;
+        }
+        std::uint64_t rowBits = 0;
+        for (std::size_t k = 0; k < 64; k += 8) {
+            const std::size_t i = base + k;
+            __m256i days = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(c.departureDays + i));
+            __m256i minutes = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(c.departureMinutes + i));
+            __m256i seats = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(c.seatsFree + i));
+            __m256i route = _mm256_and_si256(
+                _mm256_or_si256(_mm256_cmpeq_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(c.origins + i)), origin), anyOrigin),
+                _mm256_or_si256(_mm256_cmpeq_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(c.destinations + i)), destination), anyDestination));
+            __m256i outside = _mm256_or_si256(
+                _mm256_or_si256(_mm256_cmpgt_epi32(firstDay, days), _mm256_cmpgt_epi32(days, lastDay)),
+                _mm256_or_si256(_mm256_cmpgt_epi32(departsFrom, minutes), _mm256_cmpgt_epi32(minutes, departsUntil)));
+            outside = _mm256_or_si256(outside, _mm256_cmpgt_epi32(minSeats, seats));
+            __m256i pass = _mm256_andnot_si256(outside, route);
+            rowBits |= static_cast<std::uint64_t>(_mm256_movemask_ps(_mm256_castsi256_ps(pass))) << k;
+        }
+        words[w] = rowBits & statusBits;
+    }
+    if (rows % 64) words[fullWords] = scalarWord(c, p, fullWords * 64, rows);
+}
+
+#endif
+
+}
+
+// ===================================== Dispatch ===================================== //
+
+bool filterIsaSupported(FilterIsa isa) {
+    switch (isa) {
+        case FilterIsa::scalar: return true;
+#if FILTER_KERNEL_X86
+        case FilterIsa::sse41: __builtin_cpu_init(); return __builtin_cpu_supports("sse4.1");
+        case FilterIsa::avx2:  __builtin_cpu_init(); return __builtin_cpu_supports("avx2");
+#endif
+        default: return false;
+    }
+}
+
+FilterIsa bestFilterIsa() {
+    static const FilterIsa best = filterIsaSupported(FilterIsa::avx2)  ? FilterIsa::avx2
+                                : filterIsaSupported(FilterIsa::sse41) ? FilterIsa::sse41
+                                                                       : FilterIsa::scalar;
+    return best;
+}
+
+FilterKernel filterKernel(FilterIsa isa) {
+    if (!filterIsaSupported(isa)) return nullptr;
+    switch (isa) {
+#if FILTER_KERNEL_X86
+        case FilterIsa::sse41: return filterSse41;
+        case FilterIsa::avx2:  return filterAvx2;
+#endif
+        default: return filterScalar;
+    }
+}
+
+const char* filterIsaName(FilterIsa isa) {
+    switch (isa) {
+        case FilterIsa::sse41: return "sse4.1";
+        case FilterIsa::avx2:  return "avx2";
+        default:               return "scalar";
+    }
+}
@@ -1,54 +1,160 @@
 #include "../include/Flight.hpp"
+#include "../include/Snapshot.hpp"
+#include "../include/RecordStream.hpp"
+#include "../include/TimeZones.hpp"
 #include <algorithm>
 #include <ctime>
+#if defined(_MSC_VER)
+    #include <intrin.h>
+#endif
 
 // =========================================   SeatMap Class   ========================================= //
-SeatMap::SeatMap(int seatNum) : totalSeats(seatNum) {
-    for (int i = 1; i <= totalSeats; i++) {
-        seatsAvailability.emplace(i, true);
+
+// --- Word level bit helpers (64 seats per word) :
+namespace {
+    inline int popCount(std::uint64_t w) {
+    #if defined(_MSC_VER)
+        return static_cast<int>(__popcnt64(w));
+    #else
+        return __builtin_popcountll(w);
+    #endif
+    }
+
+    inline int lowestBit(std::uint64_t w) {
+    #if defined(_MSC_VER)
+        unsigned long idx;
+        _BitScanForward64(&idx, w);
+        return static_cast<int>(idx);
+    #else
+        return __builtin_ctzll(w);
+    #endif
+    }
+
+    // Mask of bits [lo, hi] inside a single word (0 <= lo <= hi <= 63)
+    inline std::uint64_t rangeMask(int lo, int hi) {
+        std::uint64_t upper = (hi == 63) ? ~0ULL : ((1ULL << (hi + 1)) - 1);
+        return upper & ~((1ULL << lo) - 1);
     }
 }
 
+SeatMap::SeatMap(int seatNum, int rowSize)
+    : totalSeats(seatNum > 0 ? seatNum : 0), seatsPerRow(rowSize > 0 ? rowSize : 1), freeSeats(0)
+{
+    freeBits.resize((totalSeats + 63) / 64);
+    resetMap();
+}
+
 bool SeatMap::bookSeat(int num) {
-    auto it = seatsAvailability.find(num);
-    if (it != seatsAvailability.end() && it->second) {
-        it->second = false;
-        return true;
-    }
-    return false;
+    if (!isValidSeat(num)) return false;
+    std::uint64_t& word = freeBits[(num - 1) >> 6];
+    std::uint64_t bit = 1ULL << ((num - 1) & 63);
+    if (!(word & bit)) return false;
+    word &= ~bit;
+    --freeSeats;
+    return true;
 }
 
 bool SeatMap::unbookSeat(int num) {
-    auto it = seatsAvailability.find(num);
-    if (it != seatsAvailability.end() && !it->second) {
-        it->second = true;
-        return true;
-    }
-    return false;
+    if (!isValidSeat(num)) return false;
+    std::uint64_t& word = freeBits[(num - 1) >> 6];
+    std::uint64_t bit = 1ULL << ((num - 1) & 63);
+    if (word & bit) return false;
+    word |= bit;
+    ++freeSeats;
+    return true;
 }
 
-int SeatMap::seatsCount() {
-    int count = 0;
-    for (const auto& seat : seatsAvailability) {
-        if (seat.second) count++;
-    }
-    return count;
+int SeatMap::seatsCount() const {
+    return freeSeats;
 }
 
 void SeatMap::resetMap() {
-    for (auto& seat : seatsAvailability) {
-        seat.second = true;
+    std::fill(freeBits.begin(), freeBits.end(), ~0ULL);
+    // clear the padding bits past the last seat so scans never return them
+    if (totalSeats % 64)
+        freeBits.back() = rangeMask(0, (totalSeats % 64) - 1);
+    freeSeats = totalSeats;
+}
+
+bool SeatMap::isSeatFree(int num) const {
+    if (!isValidSeat(num)) return false;
+    return (freeBits[(num - 1) >> 6] >> ((num - 1) & 63)) & 1ULL;
+}
+
+int SeatMap::firstFreeSeat(int from) const {
+    return firstFreeInRange(from, totalSeats);
+}
+
+// ------ First free seat in [first, last], skipping full words :
+int SeatMap::firstFreeInRange(int first, int last) const {
+    first = std::max(first, 1);
+    last  = std::min(last, totalSeats);
+    if (first > last || freeSeats == 0) return 0;
+
+    int lo = first - 1, hi = last - 1;
+    int w = lo >> 6, lastWord = hi >> 6;
+    std::uint64_t word = freeBits[w] & rangeMask(lo & 63, 63);
+    while (true) {
+        if (w == lastWord) word &= rangeMask(0, hi & 63);
+        if (word) return (w << 6) + lowestBit(word) + 1;
+        if (++w > lastWord) return 0;
+        word = freeBits[w];
     }
 }
 
+// ------ Free seats in [first, last] counted a word at a time :
+int SeatMap::freeSeatsInRange(int first, int last) const {
+    first = std::max(first, 1);
+    last  = std::min(last, totalSeats);
+    if (first > last) return 0;
+    if (first == 1 && last == totalSeats) return freeSeats;
+
+    int lo = first - 1, hi = last - 1;
+    int firstWord = lo >> 6, lastWord = hi >> 6;
+    if (firstWord == lastWord)
+        return popCount(freeBits[firstWord] & rangeMask(lo & 63, hi & 63));
+
+    int count = popCount(freeBits[firstWord] & rangeMask(lo & 63, 63));
+    for (int w = firstWord + 1; w < lastWord; w++)
+        count += popCount(freeBits[w]);
+    count += popCount(freeBits[lastWord] & rangeMask(0, hi & 63));
+    return count;
+}
+
+int SeatMap::rowCount() const {
+    return (totalSeats + seatsPerRow - 1) / seatsPerRow;
+}
+
+int SeatMap::rowOf(int num) const {
+    return isValidSeat(num) ? (num - 1) / seatsPerRow + 1 : 0;
+}
+
+int SeatMap::firstFreeInRow(int row) const {
+    return firstFreeInCabin(row, row);
+}
+
+int SeatMap::freeSeatsInRow(int row) const {
+    return freeSeatsInCabin(row, row);
+}
+
+int SeatMap::firstFreeInCabin(int firstRow, int lastRow) const {
+    if (firstRow < 1 || firstRow > lastRow) return 0;
+    return firstFreeInRange((firstRow - 1) * seatsPerRow + 1, lastRow * seatsPerRow);
+}
+
+int SeatMap::freeSeatsInCabin(int firstRow, int lastRow) const {
+    if (firstRow < 1 || firstRow > lastRow) return 0;
+    return freeSeatsInRange((firstRow - 1) * seatsPerRow + 1, lastRow * seatsPerRow);
+}
+
 // ============================================   Flight Class   ============================================ //
 
 Flight::Flight(int flightNum, const std::string& orig, const std::string& dest, FlightStatus s,
     std::shared_ptr<Aircraft> craft, const timeType& depTime, const timeType& arrTime)
     
-    : flightNumber(flightNum), origin(orig), destination(dest),
+    : flightNumber(flightNum), origin(intern(orig)), destination(intern(dest)),
       status(s), aircraft(craft), departureTime(depTime),
-      arrivalTime(arrTime), seats(craft->getCapacity()) 
+      arrivalTime(arrTime), departureDay(localDayAt(orig, depTime)), seats(craft->getCapacity()) 
 {
     if (!craft->isMaintained())
         throw std::runtime_error("Aircraft needs maintenance, Can't assign it to the flight");
@@ -70,6 +176,23 @@ void Flight::setCrew(std::shared_ptr<Crew> crew) {
     }
 }
 
+void Flight::restoreCrew(std::shared_ptr<Crew> crew) {
+    flightCrewMembers.push_back(crew);
+    crew->restoreFlight(getFlightHours());
+}
+
+void Flight::releaseCrew() {
+    for (auto& member : flightCrewMembers) {
+        if (member) member->releaseFlight(getFlightHours());
+    }
+    flightCrewMembers.clear();
+}
+
+bool Flight::hasCrew(int crewId) const {
+    return std::any_of(flightCrewMembers.begin(), flightCrewMembers.end(),
+                       [crewId](const std::shared_ptr<Crew>& member) { return member && member->getId() == crewId; });
+}
+
 // ------ Assign aircraft to the flight :
 void Flight::setAircraft(std::shared_ptr<Aircraft> craft) {
     if (craft->isMaintained()) {
@@ -80,7 +203,7 @@ void Flight::setAircraft(std::shared_ptr<Aircraft> craft) {
 }
 
 // ------ Check if flight is full :
-bool Flight::isFlightFull() {
+bool Flight::isFlightFull() const {
     return (seats.seatsCount() == 0);
 }
 
@@ -97,37 +220,18 @@ std::string Flight::getFlightDetails() const {
     return "";
 }
 // --- check if flight matches search criteria :
-bool Flight::isFlightMatch(const std::string& orgi, const std::string& desti, const timeType& time) const {
-    if (origin != orgi || destination != desti) return false;
-
-    std::time_t dep_tt = std::chrono::system_clock::to_time_t(departureTime);
-    std::time_t q_tt   = std::chrono::system_clock::to_time_t(time);
-
-    std::tm dep_tm{};
-    std::tm q_tm{};
-
-    #if defined(_WIN32)
-        localtime_s(&dep_tm, &dep_tt);
-        localtime_s(&q_tm, &q_tt);
-    #else
-        localtime_r(&dep_tt, &dep_tm);
-        localtime_r(&q_tt, &q_tm);
-    #endif
-
-    return dep_tm.tm_year == q_tm.tm_year &&
-           dep_tm.tm_mon  == q_tm.tm_mon  &&
-           dep_tm.tm_mday == q_tm.tm_mday;
+bool Flight::isFlightMatch(const std::string& orgi, const std::string& desti, const timeType& date) const {
+    if (origin.str() != orgi || destination.str() != desti) return false;
+    return departureDay == toUtcDay(date);
 }
 
 // --- Get flight details in JSON format :
 nlohmann::json Flight::getFlightJson() const {
     nlohmann::json j;
     j["flightNumber"] = flightNumber;
-    j["origin"] = origin;
-    j["destination"] = destination;
-    j["status"] = (status == FlightStatus::scheduled) ? "scheduled" :
-                  (status == FlightStatus::delayed) ? "delayed" :
-                  (status == FlightStatus::canceled) ? "canceled" : "onTime";
+    j["origin"] = origin.str();
+    j["destination"] = destination.str();
+    j["status"] = flightStatusToString(status);
     j["departureTime"] = formatDateTime(departureTime);
     j["arrivalTime"] = formatDateTime(arrivalTime);
     j["aircraftModel"] = aircraft ? aircraft->getModel() : "None";
@@ -144,65 +248,116 @@ nlohmann::json Flight::getFlightJson() const {
 
 // ============================================   FlightSystem Class   ============================================ //
 
-FlightSystem::FlightSystem() {
-    AircraftsSystem aircraftSystem;
-    aircrafts = aircraftSystem.getAircrafts();
-    Crew crew;
-    crewMembers = crew.getCrewMembers();
-
-    std::fstream flightsfile("database/Flights.json");
-    if (!flightsfile.is_open()) {
-        throw std::runtime_error("Could not open Flights.json");
+FlightSystem::FlightSystem(const AircraftsSystem& aircraftSystem, const SnapshotData* tables)
+    : aircrafts(aircraftSystem.getAircrafts()), flightsJournal("database/Flights.json", "flightNumber")
+{
+    std::vector<CrewRecord> loadedCrew;
+    if (!tables) loadedCrew = loadCrewRecords("database/Crew.json");
+    const std::vector<CrewRecord>& crewRecords = tables ? tables->crew : loadedCrew;
+    crewMembers.reserve(crewRecords.size());
+    for (const auto& r : crewRecords) {
+        auto member = std::make_shared<Crew>(r.crewID, r.name, r.role, r.totalFlightHours);
+        crewMembers.push_back(member);
+        crewById.insert(member->getId(), member);
+    }
+
+    auto addLoaded = [this](const FlightRecord& r) {
+        if (getFlightByNumber(r.flightNumber))
+            throw std::runtime_error("Duplicate flight number in JSON: " + std::to_string(r.flightNumber));
+        insertFlight(flightFromRecord(r));
+    };
+    if (tables) {
+        const std::vector<FlightRecord>& records = tables->flights;
+        flights.reserve(records.size());
+        flightsByNumber.reserve(records.size());
+        for (const auto& r : records) addLoaded(r);
+    } else {
+        streamFlightRecords("database/Flights.json", [&addLoaded](FlightRecord&& r) { addLoaded(r); },
+                            consoleProgress("flights"));
     }
 
-    nlohmann::json j;
-    flightsfile >> j;
-
-    for (const auto& item : j) {
-        int flightNum              = item["flightNumber"];
-        std::string orig           = item["origin"];
-        std::string dest           = item["destination"];
-        std::string statusStr      = item["status"];
-        std::string depTimeStr     = item["departureTime"];
-        std::string arrTimeStr     = item["arrivalTime"];
-        std::string aircraftModel  = item["aircraftModel"];
-
-        FlightStatus status;
-        if (statusStr == "scheduled") status = FlightStatus::scheduled;
-        else if (statusStr == "delayed") status = FlightStatus::delayed;
-        else if (statusStr == "canceled") status = FlightStatus::canceled;
-        else if (statusStr == "onTime") status = FlightStatus::onTime;
-        else throw std::runtime_error("Invalid flight status in JSON");
-
-        std::shared_ptr<Aircraft> aircraftPtr = nullptr;
+    // Re-apply changes journaled since the last checkpoint
+    flightsJournal.replay([this](JournalOp op, const nlohmann::json& key, const nlohmann::json& row) {
+        if (op == JournalOp::put) {
+            replayFlight(flightRecordFromJson(row));
+        } else if (op == JournalOp::remove) {
+            eraseFlight(key);
+        }
+    });
+}
+
+// ------------ Build a flight from one Flights.json row ------------ //
+std::shared_ptr<Flight> FlightSystem::flightFromRecord(const FlightRecord& r) const {
+    // Models are interned: one hash lookup for the name, then integer compares
+    std::shared_ptr<Aircraft> aircraftPtr = nullptr;
+    if (auto model = strings().find(r.aircraftModel)) {
         for (const auto& craft : aircrafts) {
-            if (craft->getModel() == aircraftModel) {
+            if (craft->getModelId() == *model) {
                 aircraftPtr = craft;
                 break;
             }
         }
-        if (!aircraftPtr)
-            throw std::runtime_error("Aircraft model not found for flight " + aircraftModel);
-
-        flights.push_back(std::make_shared<Flight>(
-            flightNum, orig, dest, status, aircraftPtr,
-            parseDate(depTimeStr), parseDate(arrTimeStr)
-        ));
-
-        auto newFlight = flights.back();
-
-        // Load assigned crew IDs
-        if (item.contains("crewIDs")) {
-            for (int id : item["crewIDs"]) {
-                for (auto& crew : crewMembers) {
-                    if (crew && crew->getId() == id) {
-                        newFlight->setCrew(crew);
-                        break;
-                    }
-                }
-            }
-        }
     }
+    if (!aircraftPtr)
+        throw std::runtime_error("Aircraft model not found for flight " + r.aircraftModel);
+
+    auto newFlight = std::make_shared<Flight>(
+        r.flightNumber, r.origin, r.destination, r.status, aircraftPtr,
+        r.departureTime, r.arrivalTime
+    );
+
+    // Attach assigned crew; they were checked for availability when assigned
+    for (int id : r.crewIDs) {
+        if (auto crew = crewById.find(id))
+            newFlight->restoreCrew(crew);
+    }
+    return newFlight;
+}
+
+// ------------ Re-apply one journaled flight row ------------ //
+// Status updates and crew assignments are patched into the existing flight, so crew keep the hours
+// they were loaded with; only a flight whose schedule or aircraft changed is rebuilt.
+void FlightSystem::replayFlight(const FlightRecord& r) {
+    auto flight = flightsByNumber.find(r.flightNumber);
+    const bool sameFlight = flight && flight->getOrigin() == r.origin && flight->getDestination() == r.destination
+        && flight->getDepartureTime() == r.departureTime && flight->getArrivalTime() == r.arrivalTime
+        && flight->getAircraft() && flight->getAircraft()->getModel() == r.aircraftModel;
+    if (!sameFlight) {
+        eraseFlight(r.flightNumber);
+        insertFlight(flightFromRecord(r));
+        return;
+    }
+    if (flight->getStatus() != r.status) {
+        metrics.flightStatusChanged(flight->getStatus(), r.status);
+        flight->changeStatus(r.status);
+        flightTable.setStatus(r.flightNumber, r.status);
+    }
+    for (int id : r.crewIDs) {
+        auto crew = crewById.find(id);
+        if (crew && !flight->hasCrew(id)) flight->restoreCrew(crew);
+    }
+}
+
+// ------------ Add / remove a flight in memory and in every index ------------ //
+void FlightSystem::insertFlight(const std::shared_ptr<Flight>& flight) {
+    flightsByNumber.insert(flight->getFlightNo(), flight);
+    flightsByRoute.insert(flight);
+    flightTable.insert(*flight);
+    metrics.flightAdded(flight->getFlightNo(), flight->getStatus(), flight->getSeatMap().getTotalSeats());
+    flights.push_back(flight);
+}
+
+bool FlightSystem::eraseFlight(int flightNum) {
+    auto flight = flightsByNumber.find(flightNum);
+    if (!flight || !flightsByNumber.erase(flightNum)) return false;
+    flight->releaseCrew();
+    flightsByRoute.erase(flightNum);
+    flightTable.erase(flightNum);
+    metrics.flightRemoved(flightNum, flight->getStatus());
+    flights.erase(std::remove_if(flights.begin(), flights.end(),
+        [flightNum](const std::shared_ptr<Flight>& f) { return f && f->getFlightNo() == flightNum; }),
+        flights.end());
+    return true;
 }
 
 // ---------------- Display all flights ----------------
@@ -212,6 +367,7 @@ void FlightSystem::displayFlights() const {
     for (auto& flight : flights) {
         std::cout << i++ << ". ";
         flight->getFlightDetails();
+        std::cout << "Seats left: " << flight->availableSeats() << "\n";
         std::cout << "-----------------------\n";
     }
 }
@@ -226,25 +382,21 @@ int FlightSystem::selectFlight() {
 
 //----------- Assign crew to flight ------------------
 void FlightSystem::selectCrew(std::shared_ptr<Flight> myflight) {
-    if (!myflight) throw std::runtime_error("Flight not found");
-
-    const int maxFlightHours = 5; // avoid <cmath> ceil; use integer math
-    const int flightHours = myflight->getFlightHours();
-    int requiredPilots = std::max(1, (flightHours + maxFlightHours - 1) / maxFlightHours);
-
-    std::vector<std::shared_ptr<Crew>> availablePilots;
-    for (auto& c : crewMembers) {
-        if (c && c->getRole() == "Pilot" && c->isCrewAvailable())
-            availablePilots.push_back(c);
+    if (!myflight) {
+        std::cout << "Flight not found.\n";
+        return;
     }
 
+    const int needed = requiredPilots(*myflight);
+    std::vector<std::shared_ptr<Crew>> availablePilots = getAvailablePilots();
+
     if (availablePilots.empty()) {
         std::cout << "No available pilots.\n";
         return;
     }
 
-    int assigned = 0;
-    while (assigned < requiredPilots && !availablePilots.empty()) {
+    std::vector<int> chosen;
+    while (static_cast<int>(chosen.size()) < needed && !availablePilots.empty()) {
         std::cout << "Available Pilots:\n";
         for (auto& p : availablePilots) p->displayCrewInfo();
 
@@ -266,36 +418,24 @@ void FlightSystem::selectCrew(std::shared_ptr<Flight> myflight) {
             std::cout << "Invalid ID or pilot not available.\n";
             continue;
         }
-
-        try {
-            myflight->setCrew(*it);
-            availablePilots.erase(it);
-            ++assigned;
-            std::cout << "Pilot assigned.\n";
-        } catch (const std::exception& e) {
-            std::cout << "Failed to assign pilot: " << e.what() << "\n";
-        }
+        chosen.push_back(id);
+        availablePilots.erase(it);
     }
 
-    if (assigned == 0) {
+    if (chosen.empty()) {
         std::cout << "No pilots assigned.\n";
         return;
     }
-    if (assigned < requiredPilots) {
-        std::cout << "Assigned " << assigned << " of " << requiredPilots << " required pilots.\n";
+    OpResult result = assignCrew(myflight->getFlightNo(), chosen);
+    if (!result.ok) {
+        std::cout << "Failed to assign pilots: " << result.error << "\n";
+        return;
+    }
+    if (static_cast<int>(chosen.size()) < needed) {
+        std::cout << "Assigned " << chosen.size() << " of " << needed << " required pilots.\n";
     } else {
         std::cout << "All required pilots assigned.\n";
     }
-
-    // Persist changes to JSON
-    nlohmann::json jArray = nlohmann::json::array();
-    for (const auto& fl : flights) {
-        if (fl) jArray.push_back(fl->getFlightJson());
-    }
-    std::ofstream outFile("database/Flights.json");
-    if (!outFile.is_open())
-        throw std::runtime_error("Could not open Flights.json for writing");
-    outFile << jArray.dump(4);
 }
 
 
@@ -310,71 +450,55 @@ void FlightSystem::updateFlightStatus(int flightNum) {
         case 2: newStatus = FlightStatus::delayed;   break;
         case 3: newStatus = FlightStatus::canceled;  break;
         case 4: newStatus = FlightStatus::onTime;    break;
-        default: throw std::runtime_error("Invalid flight status");
-    }
-
-    for (const auto& f : flights) {
-        if (f && f->getFlightNo() == flightNum) {
-            f->changeStatus(newStatus);
-
-            // Persist changes to JSON
-            nlohmann::json jArray = nlohmann::json::array();
-            for (const auto& fl : flights) {
-                if (fl) jArray.push_back(fl->getFlightJson());
-            }
-            std::ofstream outFile("database/Flights.json");
-            if (!outFile.is_open())
-                throw std::runtime_error("Could not open Flights.json for writing");
-            outFile << jArray.dump(4);
-
-            std::cout << "Status updated.\n";
+        default:
+            std::cout << "Invalid flight status.\n";
             return;
-        }
     }
-    throw std::runtime_error("Flight number incorrect");
+
+    OpResult result = updateFlightStatus(flightNum, newStatus);
+    std::cout << (result.ok ? "Status updated.\n" : result.error + "\n");
 }
 
 // -------------------------------- Add a flight to the system ---------------------------------- //
 void FlightSystem::addFlight() {
-    int flightNum;
-    std::string orig, dest, statusStr, depTimeStr, arrTimeStr, aircraftModel;
+    FlightRecord flight;
+    std::string statusStr, depTimeStr, arrTimeStr;
 
     // Ask for a unique, valid flight number 
     while (true) {
         std::cout << "Enter flight number: ";
-        std::cin >> flightNum;
+        std::cin >> flight.flightNumber;
 
-        if (getFlightByNumber(flightNum)) {
+        if (getFlightByNumber(flight.flightNumber)) {
             std::cout << "Flight number already exists. Try a different number.\n";
             continue;
         }
         break;
     }
-    std::cout << "Enter origin: ";              std::cin >> orig;
-    std::cout << "Enter destination: ";         std::cin >> dest;
+    std::cout << "Enter origin: ";              std::cin >> flight.origin;
+    std::cout << "Enter destination: ";         std::cin >> flight.destination;
 
     // Input flight status
-    FlightStatus status;
     while (true) {
         std::cout << "Enter status (1: scheduled, 2: delayed, 3: canceled, 4: onTime): ";
         std::cin >> statusStr;
 
-        if (statusStr == "1")   { status = FlightStatus::scheduled; break; }
-        if (statusStr == "2")   { status = FlightStatus::delayed;   break; }
-        if (statusStr == "3")   { status = FlightStatus::canceled; break; }
-        if (statusStr == "4")   { status = FlightStatus::onTime; break; }
+        if (statusStr == "1")   { flight.status = FlightStatus::scheduled; break; }
+        if (statusStr == "2")   { flight.status = FlightStatus::delayed;   break; }
+        if (statusStr == "3")   { flight.status = FlightStatus::canceled; break; }
+        if (statusStr == "4")   { flight.status = FlightStatus::onTime; break; }
 
         std::cout << "Invalid flight status. Please try again.\n";
     }
 
     // Get and validate times with retry on invalid input
-    timeType dep, arr;
     while (true) {
-        std::cout << "Enter departure time (YYYY-MM-DD HH:MM): ";
+        std::cout << "Enter departure time, UTC (YYYY-MM-DD HH:MM): ";
         std::cin >> std::ws;
         std::getline(std::cin, depTimeStr);
         try {
-            dep = parseDate(depTimeStr);
+            flight.departureTime = parseDate(depTimeStr);
+            flight.departureDateOnly = isDateOnly(depTimeStr);
             break;
         } catch (...) {
             std::cout << "Invalid departure time format. Please try again.\n";
@@ -382,11 +506,12 @@ void FlightSystem::addFlight() {
     }
 
     while (true) {
-        std::cout << "Enter arrival time (YYYY-MM-DD HH:MM): ";
+        std::cout << "Enter arrival time, UTC (YYYY-MM-DD HH:MM): ";
         std::getline(std::cin, arrTimeStr);
         try {
-            arr = parseDate(arrTimeStr);
-            if (arr <= dep) {
+            flight.arrivalTime = parseDate(arrTimeStr);
+            flight.arrivalDateOnly = isDateOnly(arrTimeStr);
+            if (flight.arrivalTime <= flight.departureTime) {
                 std::cout << "Arrival time must be after departure time. Please try again.\n";
                 continue;
             }
@@ -397,12 +522,11 @@ void FlightSystem::addFlight() {
     }
 
     // Ask for aircraft model until a valid one is provided
-    std::shared_ptr<Aircraft> aircraftPtr = nullptr;
-    while (!aircraftPtr) {
+    while (true) {
         std::cout << "Enter aircraft model (type 'list' to see available models): ";
-        std::getline(std::cin, aircraftModel);
+        std::getline(std::cin, flight.aircraftModel);
 
-        if (aircraftModel == "list") {
+        if (flight.aircraftModel == "list") {
             std::cout << "Available aircraft models:\n";
             for (const auto& craft : aircrafts) {
                 if (craft->isAvailable()) std::cout << "- " << craft->getModel() << "\n";
@@ -410,28 +534,10 @@ void FlightSystem::addFlight() {
             continue;
         }
 
-        for (const auto& craft : aircrafts) {
-            if (craft && craft->getModel() == aircraftModel) {
-                aircraftPtr = craft;
-                break;
-            }
-        }
-
-        if (!aircraftPtr) 
-            std::cout << "Aircraft model not found. Please try again(type 'list' to see available models).\n";
-    }
-
-    auto newFlight = std::make_shared<Flight>(flightNum, orig, dest, status, aircraftPtr, dep, arr);
-    flights.push_back(newFlight);
-
-    nlohmann::json jArray = nlohmann::json::array();
-    for (auto& f : flights) {
-        jArray.push_back(f->getFlightJson());
+        OpResult result = addFlight(flight);
+        if (result.ok) break;
+        std::cout << result.error << " Please try again(type 'list' to see available models).\n";
     }
-    std::ofstream outFile("database/Flights.json");
-    if (!outFile.is_open())
-        throw std::runtime_error("Could not open Flights.json for writing");
-    outFile << jArray.dump(4);
     std::cout << "Flight successfully added.\n";
 }
 
@@ -440,29 +546,107 @@ void FlightSystem::removeFlight() {
     int flightNum; 
     std::cout << "Enter flight number: ";
     std::cin >> flightNum;
-    
-    auto it = std::remove_if(flights.begin(), flights.end(),
-        [flightNum](const std::shared_ptr<Flight>& f) {
-            return f && f->getFlightNo() == flightNum;
-        });
-    if (it == flights.end()) {
-        throw std::runtime_error("Flight number not found");
+
+    OpResult result = removeFlight(flightNum);
+    std::cout << (result.ok ? "Flight removed successfully.\n" : result.error + "\n");
+}
+
+// ---------------------------- Headless API ---------------------------- //
+// Each change is journaled first and only then applied to memory, the metrics and the flight
+// table, as ReservationSystem::book does: if the journal write throws, nothing has changed.
+
+// --- Crew to assign, all checked before any is touched; a failure names the first bad id :
+OpResult FlightSystem::checkCrew(const std::vector<int>& crewIds, std::vector<std::shared_ptr<Crew>>& members) const {
+    for (int id : crewIds) {
+        auto member = crewById.find(id);
+        if (!member) return OpResult::failure("Crew member " + std::to_string(id) + " not found.");
+        if (!member->isCrewAvailable()) return OpResult::failure("Crew member " + std::to_string(id) + " is not available.");
+        members.push_back(member);
     }
-    flights.erase(it, flights.end());
-    std::cout << "Flight removed successfully.\n";
+    return OpResult::success();
+}
 
-    nlohmann::json jArray = nlohmann::json::array();
-    for (auto& flight : flights) {
-        if (flight) {
-            jArray.push_back(flight->getFlightJson());
-        }
+OpResult FlightSystem::addFlight(const FlightRecord& record) {
+    FlightRecord flight = record;
+    anchorBareDates(flight);
+    if (getFlightByNumber(flight.flightNumber))
+        return OpResult::failure("Flight number already exists.");
+    if (flight.arrivalTime <= flight.departureTime)
+        return OpResult::failure("Arrival time must be after departure time.");
+    auto model = strings().find(flight.aircraftModel);
+    if (!model || std::none_of(aircrafts.begin(), aircrafts.end(),
+                               [&model](const std::shared_ptr<Aircraft>& a) { return a && a->getModelId() == *model; }))
+        return OpResult::failure("Aircraft model not found.");
+    std::vector<std::shared_ptr<Crew>> members;
+    OpResult crewCheck = checkCrew(flight.crewIDs, members);
+    if (!crewCheck.ok) return crewCheck;
+
+    // Built without crew: restoreCrew (the load path) would skip the availability check
+    FlightRecord withoutCrew = flight;
+    withoutCrew.crewIDs.clear();
+    std::shared_ptr<Flight> newFlight;
+    try {
+        newFlight = flightFromRecord(withoutCrew);
+    } catch (const std::exception& e) {
+        return OpResult::failure(e.what());
     }
 
-    std::ofstream outFile("database/Flights.json");
-    if (!outFile.is_open()) {
-        throw std::runtime_error("Could not open Flights.json for writing");
+    nlohmann::json row = newFlight->getFlightJson();
+    for (const auto& member : members) row["crewIDs"].push_back(member->getId());
+    flightsJournal.put(row);
+    for (const auto& member : members) newFlight->setCrew(member);
+    insertFlight(newFlight);
+    return OpResult::success(flight.flightNumber);
+}
+
+OpResult FlightSystem::removeFlight(int flightNum) {
+    if (!getFlightByNumber(flightNum)) return OpResult::failure("Flight number not found.");
+    flightsJournal.remove(flightNum);
+    eraseFlight(flightNum);
+    return OpResult::success();
+}
+
+OpResult FlightSystem::updateFlightStatus(int flightNum, FlightStatus status) {
+    auto flight = flightsByNumber.find(flightNum);
+    if (!flight) return OpResult::failure("Flight number incorrect.");
+    nlohmann::json row = flight->getFlightJson();
+    row["status"] = flightStatusToString(status);
+    flightsJournal.put(row);
+    metrics.flightStatusChanged(flight->getStatus(), status);
+    flight->changeStatus(status);
+    flightTable.setStatus(flightNum, status);
+    return OpResult::success();
+}
+
+// --- All crew members are checked before any is assigned, so a failure changes nothing :
+OpResult FlightSystem::assignCrew(int flightNum, const std::vector<int>& crewIds) {
+    auto flight = flightsByNumber.find(flightNum);
+    if (!flight) return OpResult::failure("Flight number incorrect.");
+
+    std::vector<std::shared_ptr<Crew>> members;
+    OpResult crewCheck = checkCrew(crewIds, members);
+    if (!crewCheck.ok) return crewCheck;
+
+    nlohmann::json row = flight->getFlightJson();
+    for (const auto& member : members) row["crewIDs"].push_back(member->getId());
+    flightsJournal.put(row);
+    for (const auto& member : members) flight->setCrew(member);
+    return OpResult::success();
+}
+
+std::vector<std::shared_ptr<Crew>> FlightSystem::getAvailablePilots() const {
+    std::vector<std::shared_ptr<Crew>> pilots;
+    static const Symbol pilot = intern("Pilot");
+    for (const auto& c : crewMembers) {
+        if (c && c->getRoleId() == pilot && c->isCrewAvailable())
+            pilots.push_back(c);
     }
-    outFile << jArray.dump(4);
+    return pilots;
+}
+
+int FlightSystem::requiredPilots(const Flight& flight) const {
+    const int maxFlightHours = 5; // avoid <cmath> ceil; use integer math
+    return std::max(1, (flight.getFlightHours() + maxFlightHours - 1) / maxFlightHours);
 }
 
 // --------------- Update flight details --------------- //
@@ -471,8 +655,10 @@ std::shared_ptr<Flight> FlightSystem::updateFlight() {
     std::cout << "Enter flight number to update: ";
     std::cin >> flightNum;
     auto flight = getFlightByNumber(flightNum);
-    if (!flight)
+    if (!flight) {
         std::cout << "Flight not found. Flight ID maybe incorrect.\n";
+        return nullptr;
+    }
 
     std::cout << "Select update option:\n"
               << "1. Flight Details\n"
@@ -483,7 +669,7 @@ std::shared_ptr<Flight> FlightSystem::updateFlight() {
 
     int choice; std::cin >> choice;
     switch (choice) {
-        case 1: getFlightByNumber(flightNum)->getFlightDetails(); break;
+        case 1: flight->getFlightDetails(); break;
         case 2: selectCrew(flight); break;
         case 3: updateFlightStatus(flightNum); break;
         case 4: return nullptr; break;
@@ -495,36 +681,66 @@ std::shared_ptr<Flight> FlightSystem::updateFlight() {
 void FlightSystem::searchFlight() const {
     std::string orig, dest, dateStr;
     std::cout << "Enter origin: "; std::cin >> orig;
-    std::cout << "Enter destination: "; std::cin >> dest;
+    std::cout << "Enter destination (* for any): "; std::cin >> dest;
     std::cout << "Enter date (YYYY-MM-DD): "; std::cin >> dateStr;
 
-    timeType dateFormatted;
+    int day;
     try {
-        dateFormatted = parseDate(dateStr + " 00:00");
+        day = toUtcDay(parseDate(dateStr));
     } catch (...) {
         std::cout << "Invalid date format. Use YYYY-MM-DD.\n";
         return;
     }
 
+    auto matches = (dest == "*") ? findFlightsFrom(orig, day, day) : findFlights(orig, dest, day);
+
     std::cout << "Available Flights:\n";
     int i = 0;
-    for (const auto& flight : flights) {
-        if (flight && flight->isFlightMatch(orig, dest, dateFormatted)) {
-            std::cout << ++i << ". ";
-            flight->getFlightDetails();
-        }
+    for (const auto& flight : matches) {
+        if (flight->isFlightFull()) continue;
+        std::cout << ++i << ". ";
+        flight->getFlightDetails();
+        std::cout << "Seats left: " << flight->availableSeats() << "\n";
     }
     if (i == 0) {
         std::cout << "No Flights available.\n";
     }
 }
 
+// --- Airport names are resolved to symbols once per query; a name no flight uses matches nothing :
+std::vector<std::shared_ptr<Flight>> FlightSystem::findFlights(const std::string& orig, const std::string& dest, int day) const {
+    auto from = strings().find(orig), to = strings().find(dest);
+    if (!from || !to) return {};
+    return flightsByRoute.find(*from, *to, day);
+}
+
+std::vector<std::shared_ptr<Flight>> FlightSystem::findFlightsInRange(const std::string& orig, const std::string& dest,
+                                                                      int firstDay, int lastDay) const {
+    auto from = strings().find(orig), to = strings().find(dest);
+    if (!from || !to) return {};
+    return flightsByRoute.findInRange(*from, *to, firstDay, lastDay);
+}
+
+std::vector<std::shared_ptr<Flight>> FlightSystem::findFlightsFrom(const std::string& orig, int firstDay, int lastDay) const {
+    auto from = strings().find(orig);
+    if (!from) return {};
+    return flightsByRoute.findFrom(*from, firstDay, lastDay);
+}
+
+// --- Departures per local day in [firstDay, lastDay], a scan of the table's day column :
+std::vector<int> FlightSystem::departuresPerDay(int firstDay, int lastDay) const {
+    return flightTable.departuresPerDay(firstDay, lastDay);
+}
+
+std::vector<int> FlightSystem::departuresNextDays(const timeType& now, int days) const {
+    return flightTable.departuresNextDays(now, days);
+}
+
+void FlightSystem::syncSeats(const Flight& flight) {
+    flightTable.setSeatsFree(flight.getFlightNo(), flight.availableSeats());
+}
+
 // ----------------- Get flight by number ------------------ //
 std::shared_ptr<Flight> FlightSystem::getFlightByNumber(int flightNum) const {
-    for (const auto& flight : flights) {
-        if (flight->getFlightNo() == flightNum) {
-            return flight;
-        }
-    }
-    return nullptr;
+    return flightsByNumber.find(flightNum);
 }
@@ -0,0 +1,234 @@
+#include "../Include/FlightTable.hpp"
+#include "../Include/Flight.hpp"
+#include "../Include/Interner.hpp"
+#include "../Include/TimeZones.hpp"
+#include <chrono>
+
+// ===================================== FlightTable Class ===================================== //
+
+// ------ Row maintenance ------ //
+void FlightTable::insert(const Flight& flight) {
+    erase(flight.getFlightNo());
+    rowsByFlight.emplace(flight.getFlightNo(), flightNumbers.size());
+    flightNumbers.push_back(flight.getFlightNo());
+    origins.push_back(flight.getOriginId().id());
+    destinations.push_back(flight.getDestinationId().id());
+    departureMinutes.push_back(static_cast<std::int32_t>(std::chrono::duration_cast<std::chrono::minutes>(
+        flight.getDepartureTime().time_since_epoch()).count()));
+    departureDays.push_back(flight.getDepartureDay());
+    statuses.push_back(static_cast<std::uint8_t>(flight.getStatus()));
+    seatsFree.push_back(flight.availableSeats());
+    seatsTotal.push_back(flight.getSeatMap().getTotalSeats());
+}
+
+// --- Swap the last row into the erased one so the columns stay dense :
+bool FlightTable::erase(int flightNumber) {
+    auto it = rowsByFlight.find(flightNumber);
+    if (it == rowsByFlight.end()) return false;
+    std::size_t row = it->second;
+    std::size_t last = flightNumbers.size() - 1;
+    rowsByFlight.erase(it);
+    if (row != last) {
+        flightNumbers[row] = flightNumbers[last];
+        origins[row] = origins[last];
+        destinations[row] = destinations[last];
+        departureMinutes[row] = departureMinutes[last];
+        departureDays[row] = departureDays[last];
+        statuses[row] = statuses[last];
+        seatsFree[row] = seatsFree[last];
+        seatsTotal[row] = seatsTotal[last];
+        rowsByFlight[flightNumbers[row]] = row;
+    }
+    flightNumbers.pop_back();
+    origins.pop_back();
+    destinations.pop_back();
+    departureMinutes.pop_back();
+    departureDays.pop_back();
+    statuses.pop_back();
+    seatsFree.pop_back();
+    seatsTotal.pop_back();
+    return true;
+}
+
+void FlightTable::setStatus(int flightNumber, FlightStatus status) {
+    auto it = rowsByFlight.find(flightNumber);
+    if (it != rowsByFlight.end()) statuses[it->second] = static_cast<std::uint8_t>(status);
+}
+
+void FlightTable::setSeatsFree(int flightNumber, int seats) {
+    auto it = rowsByFlight.find(flightNumber);
+    if (it != rowsByFlight.end()) seatsFree[it->second] = seats;
+}
+
+void FlightTable::clear() {
+    flightNumbers.clear();
+    origins.clear();
+    destinations.clear();
+    departureMinutes.clear();
+    departureDays.clear();
+    statuses.clear();
+    seatsFree.clear();
+    seatsTotal.clear();
+    rowsByFlight.clear();
+}
+
+// ------ Scans ------ //
+
+namespace {
+    inline int lowestBit(std::uint64_t bits) {
+#if defined(__GNUC__) || defined(__clang__)
+        return __builtin_ctzll(bits);
+#else
+        int n = 0;
+        while (!(bits & 1)) { bits >>= 1; n++; }
+        return n;
+#endif
+    }
+
+    inline int bitCount(std::uint64_t bits) {
+#if defined(__GNUC__) || defined(__clang__)
+        return __builtin_popcountll(bits);
+#else
+        int n = 0;
+        for (; bits; bits &= bits - 1) n++;
+        return n;
+#endif
+    }
+
+    // --- Calls visit(row) for every set bit, in row order :
+    template <typename Visit>
+    void forEachSelected(const std::vector<std::uint64_t>& words, Visit&& visit) {
+        for (std::size_t w = 0; w < words.size(); w++) {
+            for (std::uint64_t bits = words[w]; bits; bits &= bits - 1) visit(w * 64 + lowestBit(bits));
+        }
+    }
+}
+
+std::size_t SelectionBitmap::count() const {
+    std::size_t n = 0;
+    for (std::uint64_t word : words) n += bitCount(word);
+    return n;
+}
+
+SelectionBitmap FlightTable::filter(const FlightQuery& query) const {
+    static const FilterIsa best = bestFilterIsa();
+    return filter(query, best);
+}
+
+// --- Airport names are resolved to symbol ids once; a name no flight uses selects nothing :
+SelectionBitmap FlightTable::filter(const FlightQuery& query, FilterIsa isa) const {
+    SelectionBitmap result;
+    result.rows = size();
+    result.words.assign((result.rows + 63) / 64, 0);
+
+    FilterPredicate predicate;
+    if (!query.origin.empty()) {
+        auto from = strings().find(query.origin);
+        if (!from) return result;
+        predicate.origin = from->id();
+        predicate.anyOrigin = false;
+    }
+    if (!query.destination.empty()) {
+        auto to = strings().find(query.destination);
+        if (!to) return result;
+        predicate.destination = to->id();
+        predicate.anyDestination = false;
+    }
+    predicate.firstDay = query.firstDay;
+    predicate.lastDay = query.lastDay;
+    predicate.departsFrom = query.departsFrom;
+    predicate.departsUntil = query.departsUntil;
+    predicate.statusMask = query.statuses;
+    predicate.minSeatsFree = query.minSeatsFree;
+
+    const FilterColumns columns{origins.data(), destinations.data(), departureMinutes.data(),
+                                departureDays.data(), statuses.data(), seatsFree.data()};
+    FilterKernel kernel = filterKernel(isa);
+    if (!kernel) kernel = filterKernel(FilterIsa::scalar);
+    kernel(columns, predicate, result.rows, result.words.data());
+    return result;
+}
+
+std::size_t FlightTable::count(const FlightQuery& query) const {
+    return filter(query).count();
+}
+
+std::vector<int> FlightTable::select(const FlightQuery& query) const {
+    std::vector<int> result;
+    forEachSelected(filter(query).bits(), [&](std::size_t row) { result.push_back(flightNumbers[row]); });
+    return result;
+}
+
+long long FlightTable::seatsFreeWhere(const FlightQuery& query) const {
+    long long total = 0;
+    forEachSelected(filter(query).bits(), [&](std::size_t row) { total += seatsFree[row]; });
+    return total;
+}
+
+// --- Departures per local day in [firstDay, lastDay], one pass over the day column :
+std::vector<int> FlightTable::departuresPerDay(int firstDay, int lastDay) const {
+    std::vector<int> counts(lastDay >= firstDay ? lastDay - firstDay + 1 : 0, 0);
+    const unsigned span = static_cast<unsigned>(counts.size());
+    for (std::int32_t day : departureDays) {
+        unsigned offset = static_cast<unsigned>(day) - static_cast<unsigned>(firstDay);  // wraps for days before firstDay
+        if (offset < span) counts[offset]++;
+    }
+    return counts;
+}
+
+// ------ Days counted from each origin's today ------ //
+
+namespace {
+    // --- Today at an airport, worked out once per origin id :
+    class OriginToday {
+    private:
+        const timeType now;
+        std::unordered_map<std::uint32_t, int> days;
+
+    public:
+        explicit OriginToday(const timeType& now) : now(now) {}
+
+        int operator()(std::uint32_t origin) {
+            auto it = days.find(origin);
+            if (it == days.end()) it = days.emplace(origin, localDayAt(Symbol(origin).str(), now)).first;
+            return it->second;
+        }
+    };
+}
+
+// --- No airport's date is more than a day off the UTC date, so the kernel first selects a window one
+//     day wider on each side; the few rows at its edges are then checked against their origin's today :
+SelectionBitmap FlightTable::filterNextDays(const FlightQuery& query, const timeType& now, int days) const {
+    const int utcToday = toUtcDay(now);
+    FlightQuery wide = query;
+    wide.firstDay = utcToday - 1;
+    wide.lastDay = days > 0 ? utcToday + days : wide.firstDay - 1;
+    SelectionBitmap result = filter(wide);
+
+    OriginToday today(now);
+    for (std::size_t w = 0; w < result.words.size(); w++) {
+        for (std::uint64_t bits = result.words[w]; bits; bits &= bits - 1) {
+            const std::size_t row = w * 64 + lowestBit(bits);
+            const int day = departureDays[row];
+            if (day > utcToday && day < utcToday + days - 1) continue;     // inside the window at every origin
+            const unsigned offset = static_cast<unsigned>(day - today(origins[row]));
+            if (offset >= static_cast<unsigned>(days)) result.words[w] &= ~(std::uint64_t(1) << (row % 64));
+        }
+    }
+    return result;
+}
+
+std::vector<int> FlightTable::departuresNextDays(const timeType& now, int days) const {
+    std::vector<int> counts(days > 0 ? days : 0, 0);
+    OriginToday today(now);
+    forEachSelected(filterNextDays(FlightQuery(), now, days).bits(), [&](std::size_t row) {
+        counts[departureDays[row] - today(origins[row])]++;
+    });
+    return counts;
+}
+
+long long FlightTable::seatsFreeIn(const SelectionBitmap& selection) const {
+    long long total = 0;
+    forEachSelected(selection.bits(), [&](std::size_t row) { total += seatsFree[row]; });
+    return total;
+}
@@ -0,0 +1,66 @@
+#include "../Include/Interner.hpp"
+#include <mutex>
+#include <stdexcept>
+
+// ===================================== StringInterner Class ===================================== //
+
+StringInterner::StringInterner() {
+    intern("");         // id 0, what a default Symbol names
+}
+
+StringInterner::~StringInterner() {
+    for (auto& chunk : chunks) delete[] chunk.load(std::memory_order_relaxed);
+}
+
+Symbol StringInterner::intern(std::string_view text) {
+    {
+        std::shared_lock<std::shared_mutex> lock(mutex);
+        auto it = ids.find(text);
+        if (it != ids.end()) return Symbol(it->second);
+    }
+
+    std::unique_lock<std::shared_mutex> lock(mutex);
+    auto it = ids.find(text);           // another thread may have added it in between
+    if (it != ids.end()) return Symbol(it->second);
+
+    std::uint32_t id = count.load(std::memory_order_relaxed);
+    std::uint32_t chunk = id >> chunkBits;
+    if (chunk >= maxChunks) throw std::runtime_error("String table is full");
+    std::string* slots = chunks[chunk].load(std::memory_order_relaxed);
+    if (!slots) {
+        slots = new std::string[chunkSize];
+        chunks[chunk].store(slots, std::memory_order_release);
+    }
+    std::string& stored = slots[id & (chunkSize - 1)];
+    stored.assign(text.data(), text.size());
+    ids.emplace(std::string_view(stored), id);
+    count.store(id + 1, std::memory_order_release);
+    return Symbol(id);
+}
+
+std::optional<Symbol> StringInterner::find(std::string_view text) const {
+    std::shared_lock<std::shared_mutex> lock(mutex);
+    auto it = ids.find(text);
+    if (it == ids.end()) return std::nullopt;
+    return Symbol(it->second);
+}
+
+const std::string& StringInterner::text(Symbol symbol) const {
+    std::uint32_t id = symbol.id();
+    return chunks[id >> chunkBits].load(std::memory_order_acquire)[id & (chunkSize - 1)];
+}
+
+StringInterner& strings() {
+    static StringInterner table;
+    return table;
+}
+
+// ===================================== Symbol Class ===================================== //
+
+const std::string& Symbol::str() const {
+    return strings().text(*this);
+}
+
+std::ostream& operator<<(std::ostream& out, Symbol symbol) {
+    return out << symbol.str();
+}
@@ -0,0 +1,206 @@
+#include "../Include/Journal.hpp"
+#include <fstream>
+#include <iostream>
+#include <unordered_map>
+
+namespace {
+    bool fileExists(const std::string& path) {
+        std::ifstream f(path);
+        return f.good();
+    }
+
+    const char* opName(JournalOp op) {
+        switch (op) {
+            case JournalOp::put:    return "put";
+            case JournalOp::remove: return "del";
+            default:                return "patch";
+        }
+    }
+
+    JournalOp opFromName(const std::string& name) {
+        if (name == "put") return JournalOp::put;
+        if (name == "del") return JournalOp::remove;
+        if (name == "patch") return JournalOp::patch;
+        throw std::runtime_error("Invalid journal operation: " + name);
+    }
+}
+
+// ===================================== Journal Class ===================================== //
+
+Journal::Journal(const std::string& snapshot, const std::string& key, std::size_t every)
+    : snapshotPath(snapshot), logPath(snapshot + ".wal"), sealedPath(snapshot + ".wal.old"),
+      keyField(key), checkpointEvery(every > 0 ? every : 1), log(snapshot + ".wal")
+{
+    // Records left over from the previous run still need to reach the snapshot
+    std::ifstream existing(logPath);
+    std::string line;
+    while (std::getline(existing, line)) pendingRecords++;
+}
+
+// --- Fold everything into the snapshot so the JSON files are complete after a clean exit :
+Journal::~Journal() {
+    try {
+        // a leftover sealed log is merged first, then the active log
+        for (int round = 0; round < 3; round++) {
+            if (checkpointer.joinable()) checkpointer.join();
+            if (pendingRecords == 0 && !fileExists(sealedPath)) break;
+            checkpoint();
+        }
+        if (checkpointer.joinable()) checkpointer.join();
+    } catch (const std::exception& e) {
+        if (checkpointer.joinable()) checkpointer.join();
+        std::cerr << "Journal checkpoint failed for " << snapshotPath << ": " << e.what() << '\n';
+    }
+}
+
+// ---------------------------- Append records ---------------------------- //
+void Journal::put(const nlohmann::json& row) {
+    commit(append({{"op", opName(JournalOp::put)}, {"key", row.at(keyField)}, {"row", row}}));
+}
+
+void Journal::remove(const nlohmann::json& key) {
+    commit(append({{"op", opName(JournalOp::remove)}, {"key", key}}));
+}
+
+void Journal::patch(const nlohmann::json& key, const nlohmann::json& fields) {
+    commit(append({{"op", opName(JournalOp::patch)}, {"key", key}, {"row", fields}}));
+}
+
+std::uint64_t Journal::append(const nlohmann::json& record) {
+    std::lock_guard<std::mutex> lock(journalMutex);
+    std::uint64_t seq = log.append(record.dump() + '\n');
+    ++pendingRecords;
+    return seq;
+}
+
+// --- Wait until `seq` is durable, then checkpoint if the log has grown enough :
+void Journal::commit(std::uint64_t seq) {
+    log.waitDurable(seq);
+    bool due;
+    {
+        std::lock_guard<std::mutex> lock(journalMutex);
+        due = pendingRecords >= checkpointEvery;
+    }
+    if (due) checkpoint();
+}
+
+// ---------------------------- Batches ---------------------------- //
+Journal::Batch::~Batch() {
+    try {
+        commit();
+    } catch (const std::exception& e) {
+        std::cerr << "Journal batch commit failed: " << e.what() << '\n';
+    }
+}
+
+void Journal::Batch::put(const nlohmann::json& row) {
+    lastSeq = journal.append({{"op", opName(JournalOp::put)}, {"key", row.at(journal.keyField)}, {"row", row}});
+}
+
+void Journal::Batch::remove(const nlohmann::json& key) {
+    lastSeq = journal.append({{"op", opName(JournalOp::remove)}, {"key", key}});
+}
+
+void Journal::Batch::patch(const nlohmann::json& key, const nlohmann::json& fields) {
+    lastSeq = journal.append({{"op", opName(JournalOp::patch)}, {"key", key}, {"row", fields}});
+}
+
+void Journal::Batch::commit() {
+    if (lastSeq == 0) return;
+    std::uint64_t seq = lastSeq;
+    lastSeq = 0;
+    journal.commit(seq);
+}
+
+// ---------------------------- Replay on startup ---------------------------- //
+void Journal::replay(const ApplyFn& apply) const {
+    replayFile(sealedPath, apply);  // older records first
+    replayFile(logPath, apply);
+}
+
+void Journal::replayFile(const std::string& path, const ApplyFn& apply) {
+    std::ifstream in(path);
+    std::string line;
+    while (std::getline(in, line)) {
+        if (line.empty()) continue;
+        nlohmann::json record = nlohmann::json::parse(line, nullptr, false);
+        if (record.is_discarded()) break;   // torn tail of a crashed append, nothing after it is valid
+
+        static const nlohmann::json noData;
+        auto row = record.find("row");
+        apply(opFromName(record.at("op")), record.at("key"), row != record.end() ? *row : noData);
+    }
+}
+
+// ---------------------------- Checkpointing ---------------------------- //
+// Seal the active log and merge it into the snapshot on a background thread.
+void Journal::checkpoint() {
+    std::lock_guard<std::mutex> lock(journalMutex);
+    if (merging) return;    // previous merge still running, a later commit will retry
+    if (checkpointer.joinable()) checkpointer.join();
+
+    // A sealed log from an earlier checkpoint (or an interrupted run) is still
+    // waiting to be merged: merge it first and keep appending to the active log.
+    if (!fileExists(sealedPath)) {
+        if (pendingRecords == 0) return;
+        log.rotate(sealedPath);
+        pendingRecords = 0;
+    }
+    startMerge();
+}
+
+// --- Called with journalMutex held :
+void Journal::startMerge() {
+    merging = true;
+    checkpointer = std::thread([this, snapshot = snapshotPath, sealed = sealedPath, key = keyField] {
+        try {
+            mergeIntoSnapshot(snapshot, sealed, key);
+        } catch (const std::exception& e) {
+            std::cerr << "Journal merge failed for " << snapshot << ": " << e.what() << '\n';
+        }
+        merging = false;
+    });
+}
+
+// --- Apply a sealed log to the snapshot file, then drop the log :
+void Journal::mergeIntoSnapshot(const std::string& snapshot, const std::string& sealed, const std::string& keyField) {
+    nlohmann::json rows = nlohmann::json::array();
+    {
+        std::ifstream in(snapshot);
+        if (in.is_open()) in >> rows;
+    }
+
+    std::unordered_map<std::string, std::size_t> positions;   // key -> index in rows
+    for (std::size_t i = 0; i < rows.size(); i++)
+        positions[rows[i].at(keyField).dump()] = i;
+
+    std::vector<bool> removed(rows.size(), false);
+    replayFile(sealed, [&](JournalOp op, const nlohmann::json& key, const nlohmann::json& data) {
+        auto it = positions.find(key.dump());
+        bool present = it != positions.end() && !removed[it->second];
+        switch (op) {
+            case JournalOp::put:
+                if (present) {
+                    rows[it->second] = data;
+                } else {
+                    positions[key.dump()] = rows.size();
+                    rows.push_back(data);
+                    removed.push_back(false);
+                }
+                break;
+            case JournalOp::remove:
+                if (present) removed[it->second] = true;
+                break;
+            case JournalOp::patch:
+                if (present) rows[it->second].update(data);
+                break;
+        }
+    });
+
+    nlohmann::json merged = nlohmann::json::array();
+    for (std::size_t i = 0; i < rows.size(); i++)
+        if (!removed[i]) merged.push_back(std::move(rows[i]));
+
+    writeFileAtomic(snapshot, merged.dump(4));
+    removeFileDurable(sealed);
+}
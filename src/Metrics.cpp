@@ -0,0 +1,133 @@
+#include "../Include/Metrics.hpp"
+#include "../Include/Flight.hpp"
+#include <algorithm>
+
+namespace {
+    std::uint64_t routeKey(Symbol origin, Symbol destination) {
+        return static_cast<std::uint64_t>(origin.id()) << 32 | destination.id();
+    }
+
+    int statusSlot(FlightStatus status) {
+        return static_cast<int>(status);
+    }
+}
+
+// ===================================== MetricsRegistry Class ===================================== //
+
+// --- FlightSystem removes a flight before adding it again (journal replay); one coming back
+//     picks up the reservations it already had :
+void MetricsRegistry::flightAdded(int flightNumber, FlightStatus status, int seatCount) {
+    flightsByStatus[statusSlot(status)]++;
+    flights++;
+    std::lock_guard<std::mutex> lock(mutex);
+    FlightMetrics& entry = byFlight[flightNumber];
+    entry.flightNumber = flightNumber;
+    entry.seats = seatCount;
+    entry.listed = true;
+    seats += seatCount;
+    seatsBooked += entry.reservations;
+}
+
+void MetricsRegistry::flightRemoved(int flightNumber, FlightStatus status) {
+    flightsByStatus[statusSlot(status)]--;
+    flights--;
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = byFlight.find(flightNumber);
+    if (it == byFlight.end() || !it->second.listed) return;
+    seats -= it->second.seats;
+    seatsBooked -= it->second.reservations;
+    if (it->second.reservations == 0) {
+        byFlight.erase(it);
+    } else {
+        it->second.seats = 0;
+        it->second.listed = false;
+    }
+}
+
+void MetricsRegistry::flightStatusChanged(FlightStatus from, FlightStatus to) {
+    if (from == to) return;
+    flightsByStatus[statusSlot(from)]--;
+    flightsByStatus[statusSlot(to)]++;
+}
+
+void MetricsRegistry::reservationAdded(const Flight* flight, int amount) {
+    reservations++;
+    revenue += amount;
+    if (!flight) return;
+    std::lock_guard<std::mutex> lock(mutex);
+    FlightMetrics& entry = byFlight[flight->getFlightNo()];
+    entry.flightNumber = flight->getFlightNo();
+    entry.reservations++;
+    entry.revenue += amount;
+    if (entry.listed) seatsBooked++;
+    RouteMetrics& route = byRoute[routeKey(flight->getOriginId(), flight->getDestinationId())];
+    route.origin = flight->getOriginId();
+    route.destination = flight->getDestinationId();
+    route.reservations++;
+    route.revenue += amount;
+}
+
+void MetricsRegistry::reservationRemoved(const Flight* flight, int amount) {
+    reservations--;
+    revenue -= amount;
+    if (!flight) return;
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = byFlight.find(flight->getFlightNo());
+    if (it != byFlight.end()) {
+        it->second.reservations--;
+        it->second.revenue -= amount;
+        if (it->second.listed) seatsBooked--;
+        else if (it->second.reservations == 0) byFlight.erase(it);
+    }
+    auto route = byRoute.find(routeKey(flight->getOriginId(), flight->getDestinationId()));
+    if (route != byRoute.end()) {
+        route->second.revenue -= amount;
+        if (--route->second.reservations == 0) byRoute.erase(route);
+    }
+}
+
+long MetricsRegistry::flightsWithStatus(FlightStatus status) const {
+    return flightsByStatus[statusSlot(status)].load(std::memory_order_relaxed);
+}
+
+double MetricsRegistry::loadFactor() const {
+    const long capacity = seats.load(std::memory_order_relaxed);
+    return capacity > 0 ? static_cast<double>(seatsBooked.load(std::memory_order_relaxed)) / capacity : 0.0;
+}
+
+FlightMetrics MetricsRegistry::flight(int flightNumber) const {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = byFlight.find(flightNumber);
+    return it != byFlight.end() ? it->second : FlightMetrics();
+}
+
+std::vector<RouteMetrics> MetricsRegistry::revenueByRoute() const {
+    std::vector<RouteMetrics> routes;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        routes.reserve(byRoute.size());
+        for (const auto& entry : byRoute) routes.push_back(entry.second);
+    }
+    std::sort(routes.begin(), routes.end(), [](const RouteMetrics& a, const RouteMetrics& b) {
+        return a.revenue != b.revenue ? a.revenue > b.revenue : routeKey(a.origin, a.destination) < routeKey(b.origin, b.destination);
+    });
+    return routes;
+}
+
+std::vector<FlightMetrics> MetricsRegistry::fullestFlights(std::size_t count) const {
+    std::vector<FlightMetrics> listed;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        listed.reserve(byFlight.size());
+        for (const auto& entry : byFlight) {
+            if (entry.second.listed) listed.push_back(entry.second);
+        }
+    }
+    const std::size_t shown = std::min(count, listed.size());
+    std::partial_sort(listed.begin(), listed.begin() + shown, listed.end(), [](const FlightMetrics& a, const FlightMetrics& b) {
+        const double la = a.loadFactor(), lb = b.loadFactor();
+        return la != lb ? la > lb : a.flightNumber < b.flightNumber;
+    });
+    listed.resize(shown);
+    return listed;
+}
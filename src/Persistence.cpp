@@ -0,0 +1,184 @@
+#include "../Include/Persistence.hpp"
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <stdexcept>
+
+#if defined(_WIN32)
+    #include <fcntl.h>
+    #include <io.h>
+    #include <windows.h>
+#else
+    #include <fcntl.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+// ===================================== Low level file calls ===================================== //
+namespace {
+    [[noreturn]] void fail(const std::string& what, const std::string& path) {
+        throw std::runtime_error(what + " " + path + ": " + std::strerror(errno));
+    }
+
+    int openFile(const std::string& path, bool truncate) {
+    #if defined(_WIN32)
+        int flags = _O_WRONLY | _O_CREAT | _O_BINARY | (truncate ? _O_TRUNC : _O_APPEND);
+        return _open(path.c_str(), flags, _S_IREAD | _S_IWRITE);
+    #else
+        int flags = O_WRONLY | O_CREAT | (truncate ? O_TRUNC : O_APPEND);
+        return ::open(path.c_str(), flags, 0644);
+    #endif
+    }
+
+    void writeAll(int fd, const std::string& data, const std::string& path) {
+        const char* p = data.data();
+        std::size_t left = data.size();
+        while (left > 0) {
+        #if defined(_WIN32)
+            int n = _write(fd, p, static_cast<unsigned>(left));
+        #else
+            ssize_t n = ::write(fd, p, left);
+            if (n < 0 && errno == EINTR) continue;
+        #endif
+            if (n <= 0) fail("Could not write", path);
+            p += n;
+            left -= static_cast<std::size_t>(n);
+        }
+    }
+
+    void syncFd(int fd, const std::string& path) {
+    #if defined(_WIN32)
+        if (_commit(fd) != 0) fail("Could not sync", path);
+    #else
+        if (::fsync(fd) != 0) fail("Could not sync", path);
+    #endif
+    }
+
+    void closeFd(int fd) {
+    #if defined(_WIN32)
+        _close(fd);
+    #else
+        ::close(fd);
+    #endif
+    }
+}
+
+// ===================================== Durable file helpers ===================================== //
+
+// --- Make a rename / create / delete inside a directory survive a crash :
+void syncParentDirectory(const std::string& path) {
+#if defined(_WIN32)
+    (void)path;     // MoveFileEx(MOVEFILE_WRITE_THROUGH) already flushed the directory entry
+#else
+    auto slash = path.find_last_of('/');
+    std::string dir = (slash == std::string::npos) ? "." : path.substr(0, slash == 0 ? 1 : slash);
+    int fd = ::open(dir.c_str(), O_RDONLY);
+    if (fd < 0) fail("Could not open directory", dir);
+    ::fsync(fd);    // some file systems refuse directory fsync, nothing more we can do then
+    ::close(fd);
+#endif
+}
+
+void renameFileDurable(const std::string& from, const std::string& to) {
+#if defined(_WIN32)
+    if (!MoveFileExA(from.c_str(), to.c_str(), MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH))
+        throw std::runtime_error("Could not rename " + from + " to " + to);
+#else
+    if (std::rename(from.c_str(), to.c_str()) != 0) fail("Could not rename", from);
+#endif
+    syncParentDirectory(to);
+}
+
+void removeFileDurable(const std::string& path) {
+    if (std::remove(path.c_str()) != 0 && errno != ENOENT) fail("Could not remove", path);
+    syncParentDirectory(path);
+}
+
+// --- Write a whole file : temp file -> fsync -> rename over target -> fsync directory :
+void writeFileAtomic(const std::string& path, const std::string& contents) {
+    const std::string tmp = path + ".tmp";
+    int fd = openFile(tmp, true);
+    if (fd < 0) fail("Could not open", tmp);
+    try {
+        writeAll(fd, contents, tmp);
+        syncFd(fd, tmp);
+    } catch (...) {
+        closeFd(fd);
+        std::remove(tmp.c_str());
+        throw;
+    }
+    closeFd(fd);
+    renameFileDurable(tmp, path);
+}
+
+// ===================================== DurableLog Class ===================================== //
+
+DurableLog::DurableLog(const std::string& logPath) : path(logPath) {
+    open();
+}
+
+DurableLog::~DurableLog() {
+    try {
+        waitDurable(appendedSeq);
+    } catch (...) {}
+    close();
+}
+
+void DurableLog::open() {
+    fd = openFile(path, false);
+    if (fd < 0) fail("Could not open journal", path);
+}
+
+void DurableLog::close() {
+    if (fd >= 0) closeFd(fd);
+    fd = -1;
+}
+
+std::uint64_t DurableLog::append(const std::string& data) {
+    std::lock_guard<std::mutex> lock(logMutex);
+    writeAll(fd, data, path);
+    return ++appendedSeq;
+}
+
+// --- Group commit: one leader fsyncs for every record appended before it started :
+void DurableLog::waitDurable(std::uint64_t seq) {
+    std::unique_lock<std::mutex> lock(logMutex);
+    while (durableSeq < seq) {
+        if (syncing) {
+            synced.wait(lock);
+            continue;
+        }
+        syncing = true;
+        const std::uint64_t target = appendedSeq;
+        const int syncFdNum = fd;
+        lock.unlock();
+        try {
+            syncFd(syncFdNum, path);
+        } catch (...) {
+            lock.lock();
+            syncing = false;
+            synced.notify_all();
+            throw;
+        }
+        lock.lock();
+        syncing = false;
+        if (target > durableSeq) durableSeq = target;
+        synced.notify_all();
+    }
+}
+
+void DurableLog::rotate(const std::string& sealedPath) {
+    std::unique_lock<std::mutex> lock(logMutex);
+    synced.wait(lock, [this] { return !syncing; });   // never close the fd under a running fsync
+    syncFd(fd, path);
+    durableSeq = appendedSeq;
+    close();
+    try {
+        renameFileDurable(path, sealedPath);
+    } catch (...) {
+        open();
+        throw;
+    }
+    open();
+    synced.notify_all();
+}
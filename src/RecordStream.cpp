@@ -0,0 +1,286 @@
+#include "../Include/RecordStream.hpp"
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <vector>
+
+namespace {
+    // ---------------------------- One scalar from the parser ---------------------------- //
+    struct SaxValue {
+        enum class Kind {null, boolean, integer, number, string} kind = Kind::null;
+        bool b = false;
+        std::int64_t i = 0;
+        double d = 0.0;
+        std::string* s = nullptr;       // points into the parser's buffer, valid during the event
+
+        int asInt() const {
+            if (kind != Kind::integer) throw std::runtime_error("expected an integer");
+            return static_cast<int>(i);
+        }
+        double asDouble() const {
+            if (kind == Kind::integer) return static_cast<double>(i);
+            if (kind != Kind::number) throw std::runtime_error("expected a number");
+            return d;
+        }
+        bool asBool() const {
+            if (kind != Kind::boolean) throw std::runtime_error("expected true/false");
+            return b;
+        }
+        std::string asString() const {
+            if (kind != Kind::string) throw std::runtime_error("expected a string");
+            return std::move(*s);
+        }
+    };
+
+    // --- A field of Record reachable by a dotted path ("payment.amount"); array elements use the array's path :
+    template <typename Record>
+    struct FieldSpec {
+        const char* path;
+        bool required;
+        void (*set)(Record& r, const SaxValue& v);
+    };
+
+    const FieldSpec<AircraftRecord> aircraftFields[] = {
+        {"model",           true, [](AircraftRecord& r, const SaxValue& v) { r.model = v.asString(); }},
+        {"capacity",        true, [](AircraftRecord& r, const SaxValue& v) { r.capacity = v.asInt(); }},
+        {"available",       true, [](AircraftRecord& r, const SaxValue& v) { r.available = v.asBool(); }},
+        {"lastMaintenance", true, [](AircraftRecord& r, const SaxValue& v) { r.lastMaintenance = parseDate(v.asString()); }},
+        {"nextMaintenance", true, [](AircraftRecord& r, const SaxValue& v) { r.nextMaintenance = parseDate(v.asString()); }},
+    };
+
+    const FieldSpec<CrewRecord> crewFields[] = {
+        {"crewID",           true, [](CrewRecord& r, const SaxValue& v) { r.crewID = v.asInt(); }},
+        {"name",             true, [](CrewRecord& r, const SaxValue& v) { r.name = v.asString(); }},
+        {"role",             true, [](CrewRecord& r, const SaxValue& v) { r.role = v.asString(); }},
+        {"totalFlightHours", true, [](CrewRecord& r, const SaxValue& v) { r.totalFlightHours = v.asDouble(); }},
+    };
+
+    const FieldSpec<UserRecord> userFields[] = {
+        {"id",       true, [](UserRecord& r, const SaxValue& v) { r.id = v.asInt(); }},
+        {"name",     true, [](UserRecord& r, const SaxValue& v) { r.name = v.asString(); }},
+        {"email",    true, [](UserRecord& r, const SaxValue& v) { r.email = v.asString(); }},
+        {"password", true, [](UserRecord& r, const SaxValue& v) { r.password = v.asString(); }},
+        {"role",     true, [](UserRecord& r, const SaxValue& v) { r.role = stringToRole(v.asString()); }},
+    };
+
+    const FieldSpec<FlightRecord> flightFields[] = {
+        {"flightNumber",  true,  [](FlightRecord& r, const SaxValue& v) { r.flightNumber = v.asInt(); }},
+        {"origin",        true,  [](FlightRecord& r, const SaxValue& v) { r.origin = v.asString(); }},
+        {"destination",   true,  [](FlightRecord& r, const SaxValue& v) { r.destination = v.asString(); }},
+        {"status",        true,  [](FlightRecord& r, const SaxValue& v) { r.status = stringToFlightStatus(v.asString()); }},
+        {"departureTime", true,  [](FlightRecord& r, const SaxValue& v) {
+            const std::string text = v.asString();
+            r.departureTime = parseDate(text);
+            r.departureDateOnly = isDateOnly(text);
+        }},
+        {"arrivalTime",   true,  [](FlightRecord& r, const SaxValue& v) {
+            const std::string text = v.asString();
+            r.arrivalTime = parseDate(text);
+            r.arrivalDateOnly = isDateOnly(text);
+        }},
+        {"aircraftModel", true,  [](FlightRecord& r, const SaxValue& v) { r.aircraftModel = v.asString(); }},
+        {"crewIDs",       false, [](FlightRecord& r, const SaxValue& v) { r.crewIDs.push_back(v.asInt()); }},
+    };
+
+    const FieldSpec<ReservationRecord> reservationFields[] = {
+        {"reservationId",   true,  [](ReservationRecord& r, const SaxValue& v) { r.reservationId = v.asInt(); }},
+        {"passengerid",     true,  [](ReservationRecord& r, const SaxValue& v) { r.passengerId = v.asInt(); }},
+        {"flightNumber",    true,  [](ReservationRecord& r, const SaxValue& v) { r.flightNumber = v.asInt(); }},
+        {"seatNumber",      true,  [](ReservationRecord& r, const SaxValue& v) { r.seatNumber = v.asInt(); }},
+        {"checkIn",         false, [](ReservationRecord& r, const SaxValue& v) { r.checkIn = v.asString(); }},
+        {"payment.method",  true,  [](ReservationRecord& r, const SaxValue& v) { r.method = v.asString(); }},
+        {"payment.details", true,  [](ReservationRecord& r, const SaxValue& v) { r.details = v.asString(); }},
+        {"payment.amount",  true,  [](ReservationRecord& r, const SaxValue& v) { r.amount = v.asInt(); }},
+    };
+
+    // ===================================== RecordSaxHandler Class ===================================== //
+    // Expects a top-level array of objects. Keeps the dotted path of the current position
+    // inside the row and assigns each scalar to the field registered for that path.
+    template <typename Record, std::size_t N>
+    class RecordSaxHandler : public nlohmann::json_sax<nlohmann::json> {
+    private:
+        const FieldSpec<Record> (&fields)[N];
+        const RecordSink<Record>& sink;
+        const JsonProgressFn& progress;
+        std::istream& input;
+        std::uint64_t totalBytes;
+
+        std::vector<bool> inObject;                 // container stack, true = object
+        std::vector<std::size_t> pathLengths;       // path length before each nested container
+        std::string path;                           // dotted path of the enclosing container inside the row
+        std::string lastKey;                        // last key of the innermost object
+        Record current;
+        std::uint32_t seenRequired = 0;
+        std::size_t rows = 0;
+
+        std::string fieldPath() const {
+            if (!inObject.back()) return path;
+            return path.empty() ? lastKey : path + "." + lastKey;
+        }
+
+        bool scalar(const SaxValue& v) {
+            if (inObject.size() < 2)
+                throw std::runtime_error("expected an array of objects");
+            const std::string field = fieldPath();
+            for (std::size_t f = 0; f < N; f++) {
+                if (field != fields[f].path) continue;
+                try {
+                    fields[f].set(current, v);
+                } catch (const std::exception& e) {
+                    throw std::runtime_error("row " + std::to_string(rows) + ", field " + field + ": " + e.what());
+                }
+                if (fields[f].required) seenRequired |= (1u << f);
+                break;
+            }
+            return true;
+        }
+
+        bool openContainer(bool object) {
+            if (inObject.empty() && object)
+                throw std::runtime_error("expected an array of objects");
+            if (inObject.size() == 1) {
+                if (!object) throw std::runtime_error("expected an array of objects");
+                current = Record();
+                seenRequired = 0;
+                path.clear();
+            } else if (inObject.size() >= 2) {
+                pathLengths.push_back(path.size());
+                path = fieldPath();
+            }
+            inObject.push_back(object);
+            return true;
+        }
+
+        bool closeContainer() {
+            inObject.pop_back();
+            if (inObject.size() == 1) {
+                finishRow();
+            } else if (inObject.size() >= 2) {
+                path.resize(pathLengths.back());
+                pathLengths.pop_back();
+            }
+            return true;
+        }
+
+        void finishRow() {
+            for (std::size_t f = 0; f < N; f++) {
+                if (fields[f].required && !(seenRequired & (1u << f)))
+                    throw std::runtime_error("row " + std::to_string(rows) + " is missing field " + fields[f].path);
+            }
+            sink(std::move(current));
+            if (++rows % 4096 == 0 && progress) progress(static_cast<std::uint64_t>(input.tellg()), totalBytes);
+        }
+
+    public:
+        RecordSaxHandler(const FieldSpec<Record> (&f)[N], const RecordSink<Record>& s, const JsonProgressFn& p,
+                         std::istream& in, std::uint64_t total)
+            : fields(f), sink(s), progress(p), input(in), totalBytes(total) {
+            static_assert(N <= 32, "seenRequired holds one bit per field");
+        }
+
+        std::size_t rowCount() const { return rows; }
+
+        bool null() override                              { return scalar(SaxValue{}); }
+        bool boolean(bool val) override                   { SaxValue v; v.kind = SaxValue::Kind::boolean; v.b = val; return scalar(v); }
+        bool number_integer(number_integer_t val) override { SaxValue v; v.kind = SaxValue::Kind::integer; v.i = val; return scalar(v); }
+        bool number_unsigned(number_unsigned_t val) override {
+            SaxValue v; v.kind = SaxValue::Kind::integer; v.i = static_cast<std::int64_t>(val); return scalar(v);
+        }
+        bool number_float(number_float_t val, const string_t&) override {
+            SaxValue v; v.kind = SaxValue::Kind::number; v.d = val; return scalar(v);
+        }
+        bool string(string_t& val) override               { SaxValue v; v.kind = SaxValue::Kind::string; v.s = &val; return scalar(v); }
+        bool binary(binary_t&) override                   { return true; }
+
+        bool start_object(std::size_t) override           { return openContainer(true); }
+        bool key(string_t& val) override                  { lastKey = val; return true; }
+        bool end_object() override                        { return closeContainer(); }
+        bool start_array(std::size_t) override            { return openContainer(false); }
+        bool end_array() override                         { return closeContainer(); }
+
+        bool parse_error(std::size_t position, const std::string&, const nlohmann::detail::exception& ex) override {
+            throw std::runtime_error("byte " + std::to_string(position) + ": " + ex.what());
+        }
+    };
+
+    template <typename Record, std::size_t N>
+    std::size_t streamRecords(const std::string& path, const FieldSpec<Record> (&fields)[N],
+                              const RecordSink<Record>& sink, const JsonProgressFn& progress) {
+        std::vector<char> buffer(1 << 20);      // large reads instead of the default few KB
+        std::ifstream file;
+        file.rdbuf()->pubsetbuf(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+        file.open(path, std::ios::binary);
+        if (!file.is_open())
+            throw std::runtime_error("Could not open " + path);
+
+        file.seekg(0, std::ios::end);
+        const std::uint64_t total = static_cast<std::uint64_t>(file.tellg());
+        file.seekg(0, std::ios::beg);
+
+        RecordSaxHandler<Record, N> handler(fields, sink, progress, file, total);
+        try {
+            nlohmann::json::sax_parse(file, &handler);
+        } catch (const std::exception& e) {
+            throw std::runtime_error("Invalid " + path + ": " + e.what());
+        }
+        if (progress) progress(total, total);
+        return handler.rowCount();
+    }
+}
+
+// ===================================== Public loaders ===================================== //
+
+std::size_t streamAircraftRecords(const std::string& path, const RecordSink<AircraftRecord>& sink,
+                                  const JsonProgressFn& progress) {
+    return streamRecords(path, aircraftFields, sink, progress);
+}
+
+std::size_t streamCrewRecords(const std::string& path, const RecordSink<CrewRecord>& sink,
+                              const JsonProgressFn& progress) {
+    return streamRecords(path, crewFields, sink, progress);
+}
+
+std::size_t streamUserRecords(const std::string& path, const RecordSink<UserRecord>& sink,
+                              const JsonProgressFn& progress) {
+    return streamRecords(path, userFields, sink, progress);
+}
+
+std::size_t streamFlightRecords(const std::string& path, const RecordSink<FlightRecord>& sink,
+                                const JsonProgressFn& progress) {
+    // Bare dates are anchored once the row is complete, when its airports are known
+    const RecordSink<FlightRecord> anchored = [&sink](FlightRecord&& r) {
+        anchorBareDates(r);
+        sink(std::move(r));
+    };
+    return streamRecords(path, flightFields, anchored, progress);
+}
+
+std::size_t streamReservationRecords(const std::string& path, const RecordSink<ReservationRecord>& sink,
+                                     const JsonProgressFn& progress) {
+    return streamRecords(path, reservationFields, sink, progress);
+}
+
+// ---------------------------- Console progress ---------------------------- //
+// Bootstrap parses several tables on parallel threads, so the printers share one lock and the
+// line they are redrawing: another table's update starts a fresh line instead of mixing into it.
+namespace {
+    std::mutex progressMutex;
+    std::string progressLine;                       // label of the unfinished "\r" line, empty if none
+}
+
+JsonProgressFn consoleProgress(const std::string& label) {
+    const std::uint64_t minBytes = 16u << 20;       // files under 16 MB load too fast to bother
+    auto lastShown = std::make_shared<int>(-1);
+    return [label, minBytes, lastShown](std::uint64_t done, std::uint64_t total) {
+        if (total < minBytes) return;
+        int percent = static_cast<int>(done * 100 / total);
+        if (percent == *lastShown || (percent < *lastShown + 5 && percent != 100)) return;
+        *lastShown = percent;
+        std::lock_guard<std::mutex> lock(progressMutex);
+        if (!progressLine.empty() && progressLine != label) std::cout << "\n";
+        std::cout << "\rLoading " << label << ": " << percent << "%" << (percent == 100 ? "\n" : "") << std::flush;
+        progressLine = percent == 100 ? std::string() : label;
+    };
+}
@@ -0,0 +1,165 @@
+#include "../Include/Records.hpp"
+#include "../Include/RecordStream.hpp"
+#include "../Include/TimeZones.hpp"
+
+// ===================================== JSON row -> record ===================================== //
+
+AircraftRecord aircraftRecordFromJson(const nlohmann::json& item) {
+    AircraftRecord r;
+    r.model             = item["model"];
+    r.capacity          = item["capacity"];
+    r.available         = item["available"];
+    r.lastMaintenance   = parseDate(item["lastMaintenance"]);
+    r.nextMaintenance   = parseDate(item["nextMaintenance"]);
+    return r;
+}
+
+CrewRecord crewRecordFromJson(const nlohmann::json& item) {
+    CrewRecord r;
+    r.crewID            = item["crewID"];
+    r.name              = item["name"];
+    r.role              = item["role"];
+    r.totalFlightHours  = item["totalFlightHours"];
+    return r;
+}
+
+UserRecord userRecordFromJson(const nlohmann::json& item) {
+    UserRecord r;
+    r.id        = item["id"];
+    r.name      = item["name"];
+    r.email     = item["email"];
+    r.password  = item["password"];
+    r.role      = stringToRole(item["role"]);
+    return r;
+}
+
+FlightRecord flightRecordFromJson(const nlohmann::json& item) {
+    FlightRecord r;
+    r.flightNumber  = item["flightNumber"];
+    r.origin        = item["origin"];
+    r.destination   = item["destination"];
+    r.status        = stringToFlightStatus(item["status"]);
+    r.departureTime = parseDate(item["departureTime"]);
+    r.arrivalTime   = parseDate(item["arrivalTime"]);
+    r.departureDateOnly = isDateOnly(item["departureTime"]);
+    r.arrivalDateOnly   = isDateOnly(item["arrivalTime"]);
+    r.aircraftModel = item["aircraftModel"];
+    if (item.contains("crewIDs")) {
+        for (int id : item["crewIDs"]) r.crewIDs.push_back(id);
+    }
+    anchorBareDates(r);
+    return r;
+}
+
+// --- A bare "2025-11-01" names that day where the flight is, not UTC midnight, which west of
+//     UTC is still the previous evening :
+void anchorBareDates(FlightRecord& r) {
+    if (r.departureDateOnly) r.departureTime = localMidnightAt(r.origin, toUtcDay(r.departureTime));
+    if (r.arrivalDateOnly) r.arrivalTime = localMidnightAt(r.destination, toUtcDay(r.arrivalTime));
+    r.departureDateOnly = r.arrivalDateOnly = false;
+}
+
+ReservationRecord reservationRecordFromJson(const nlohmann::json& item) {
+    ReservationRecord r;
+    r.reservationId = item["reservationId"];
+    r.passengerId   = item["passengerid"];
+    r.flightNumber  = item["flightNumber"];
+    r.seatNumber    = item["seatNumber"];
+    r.checkIn       = item.value("checkIn", "not yet");
+    r.method        = item["payment"]["method"];
+    r.details       = item["payment"]["details"];
+    r.amount        = item["payment"]["amount"];
+    return r;
+}
+
+// ===================================== Record -> JSON row ===================================== //
+
+nlohmann::json toJson(const AircraftRecord& r) {
+    return {
+        {"model", r.model},
+        {"capacity", r.capacity},
+        {"available", r.available},
+        {"lastMaintenance", formatDateTime(r.lastMaintenance)},
+        {"nextMaintenance", formatDateTime(r.nextMaintenance)}
+    };
+}
+
+nlohmann::json toJson(const CrewRecord& r) {
+    return {
+        {"crewID", r.crewID},
+        {"name", r.name},
+        {"role", r.role},
+        {"totalFlightHours", r.totalFlightHours}
+    };
+}
+
+nlohmann::json toJson(const UserRecord& r) {
+    return {
+        {"id", r.id},
+        {"name", r.name},
+        {"email", r.email},
+        {"password", r.password},
+        {"role", roleToString(r.role)}
+    };
+}
+
+nlohmann::json toJson(const FlightRecord& r) {
+    return {
+        {"flightNumber", r.flightNumber},
+        {"origin", r.origin},
+        {"destination", r.destination},
+        {"status", flightStatusToString(r.status)},
+        {"departureTime", formatDateTime(r.departureTime)},
+        {"arrivalTime", formatDateTime(r.arrivalTime)},
+        {"aircraftModel", r.aircraftModel},
+        {"crewIDs", r.crewIDs}
+    };
+}
+
+nlohmann::json toJson(const ReservationRecord& r) {
+    return {
+        {"reservationId", r.reservationId},
+        {"passengerid", r.passengerId},
+        {"flightNumber", r.flightNumber},
+        {"seatNumber", r.seatNumber},
+        {"checkIn", r.checkIn},
+        {"payment", {
+            {"method", r.method},
+            {"details", r.details},
+            {"amount", r.amount}
+        }}
+    };
+}
+
+// ===================================== Whole-file loaders ===================================== //
+// Streamed through the SAX loaders, so only the records are held, never a DOM of the file.
+
+std::vector<AircraftRecord> loadAircraftRecords(const std::string& path, const JsonProgressFn& progress) {
+    std::vector<AircraftRecord> records;
+    streamAircraftRecords(path, [&records](AircraftRecord&& r) { records.push_back(std::move(r)); }, progress);
+    return records;
+}
+
+std::vector<CrewRecord> loadCrewRecords(const std::string& path, const JsonProgressFn& progress) {
+    std::vector<CrewRecord> records;
+    streamCrewRecords(path, [&records](CrewRecord&& r) { records.push_back(std::move(r)); }, progress);
+    return records;
+}
+
+std::vector<UserRecord> loadUserRecords(const std::string& path, const JsonProgressFn& progress) {
+    std::vector<UserRecord> records;
+    streamUserRecords(path, [&records](UserRecord&& r) { records.push_back(std::move(r)); }, progress);
+    return records;
+}
+
+std::vector<FlightRecord> loadFlightRecords(const std::string& path, const JsonProgressFn& progress) {
+    std::vector<FlightRecord> records;
+    streamFlightRecords(path, [&records](FlightRecord&& r) { records.push_back(std::move(r)); }, progress);
+    return records;
+}
+
+std::vector<ReservationRecord> loadReservationRecords(const std::string& path, const JsonProgressFn& progress) {
+    std::vector<ReservationRecord> records;
+    streamReservationRecords(path, [&records](ReservationRecord&& r) { records.push_back(std::move(r)); }, progress);
+    return records;
+}
@@ -1,17 +1,59 @@
 #include "../Include/Reports.hpp"
+#include "../Include/Flight.hpp"
+#include "../Include/Reservation.hpp"
+#include <algorithm>
+#include <cstdio>
 #include <iostream>
 #include <fstream>
 #include "../Include/json.hpp"
 
-void Reports::generateOperationalReport() const {
+void Reports::generateOperationalReport(const FlightSystem& flightSystem) const {
     std::cout << "\n--- Operational Report ---\n";
-    std::ifstream flightsFile("database/Flights.json");
-    std::ifstream reservationsFile("reservation.json");
-    nlohmann::json flightsJson, reservationsJson;
-    if (flightsFile) flightsFile >> flightsJson;
-    if (reservationsFile) reservationsFile >> reservationsJson;
-    std::cout << "Total Flights: " << flightsJson.size() << "\n";
-    std::cout << "Total Reservations: " << reservationsJson.size() << "\n";
+    // Totals come from the live counters the systems keep up to date (no file is read)
+    const MetricsRegistry& metrics = flightSystem.getMetrics();
+    std::cout << "Total Flights: " << metrics.totalFlights() << "\n";
+    for (FlightStatus status : {FlightStatus::scheduled, FlightStatus::delayed, FlightStatus::canceled, FlightStatus::onTime})
+        std::cout << "  " << flightStatusToString(status) << ": " << metrics.flightsWithStatus(status) << "\n";
+    std::cout << "Total Reservations: " << metrics.totalReservations() << "\n";
+    std::cout << "Total Revenue: " << metrics.totalRevenue() << "\n";
+    char loadFactor[32];
+    std::snprintf(loadFactor, sizeof loadFactor, "%.1f%%", 100.0 * metrics.loadFactor());
+    std::cout << "Load Factor: " << loadFactor << " of " << metrics.totalSeats() << " seats\n";
+
+    const std::vector<RouteMetrics> routes = metrics.revenueByRoute();
+    const std::size_t shown = std::min<std::size_t>(routes.size(), 10);
+    std::cout << "Revenue by route (top " << shown << " of " << routes.size() << "):\n";
+    for (std::size_t i = 0; i < shown; i++) {
+        std::cout << "  " << routes[i].origin << " -> " << routes[i].destination << ": " << routes[i].revenue
+                  << " (" << routes[i].reservations << " reservations)\n";
+    }
+
+    const std::vector<FlightMetrics> fullest = metrics.fullestFlights(10);
+    std::cout << "Fullest flights (top " << fullest.size() << " of " << metrics.totalFlights() << "):\n";
+    for (const FlightMetrics& f : fullest) {
+        std::snprintf(loadFactor, sizeof loadFactor, "%.1f%%", 100.0 * f.loadFactor());
+        std::cout << "  Flight " << f.flightNumber << ": " << f.reservations << "/" << f.seats << " seats ("
+                  << loadFactor << "), revenue " << f.revenue << "\n";
+    }
+    const FlightTable& table = flightSystem.getFlightTable();
+
+    // Departure days are precomputed per flight as the origin's local date, so "today" is taken at
+    // each flight's origin too: day 0 is whatever date it is there now, not the UTC date
+    const timeType now = std::chrono::system_clock::now();
+    std::vector<int> perDay = flightSystem.departuresNextDays(now, 7);
+    std::cout << "Departures in the next 7 days (local dates at each origin):\n";
+    for (std::size_t i = 0; i < perDay.size(); i++) {
+        std::cout << "  " << (i == 0 ? std::string("today") : "today+" + std::to_string(i)) << ": " << perDay[i] << "\n";
+    }
+
+    // Status breakdown of the same week, one column scan per status
+    FlightQuery week;
+    for (FlightStatus status : {FlightStatus::scheduled, FlightStatus::delayed, FlightStatus::canceled, FlightStatus::onTime}) {
+        week.statuses = statusBit(status);
+        std::cout << "  " << flightStatusToString(status) << " this week: " << table.filterNextDays(week, now, 7).count() << "\n";
+    }
+    week.statuses = anyStatus;
+    std::cout << "Seats still free this week: " << table.seatsFreeIn(table.filterNextDays(week, now, 7)) << "\n";
 }
 
 void Reports::generateMaintenanceReport() const {
@@ -26,14 +68,15 @@ void Reports::generateMaintenanceReport() const {
     }
 }
 
-void Reports::generateUserActivityReport() const {
+// --- Bookings of every listed flight, from the live reservation system (the JSON file lags the journal) :
+void Reports::generateUserActivityReport(const FlightSystem& flightSystem, const ReservationSystem& reservationSystem) const {
     std::cout << "\n--- User Activity Report ---\n";
-    std::ifstream reservationsFile("reservation.json");
-    nlohmann::json reservationsJson;
-    if (reservationsFile) reservationsFile >> reservationsJson;
-    for (const auto& res : reservationsJson) {
-        std::cout << "Passenger: " << res.value("passengerName", "N/A")
-                  << " | Flight: " << res.value("flightNumber", "N/A")
-                  << " | Status: " << res.value("checkIn", "N/A") << "\n";
+    for (const auto& flight : flightSystem.getFlights()) {
+        for (const ManifestEntry& entry : reservationSystem.getManifest(flight->getFlightNo())) {
+            std::cout << "Passenger: " << (entry.passengerName.empty() ? "N/A" : entry.passengerName)
+                      << " | Flight: " << flight->getFlightNo()
+                      << " | Seat: " << entry.seatNumber
+                      << " | Status: " << (entry.checkedIn ? "Checked in" : "Not yet") << "\n";
+        }
     }
-}
\ No newline at end of file
+}
@@ -2,16 +2,25 @@
 #include "User.hpp"
 #include "UserSystem.hpp"
 #include "Flight.hpp"
+#include "Snapshot.hpp"
+#include "RecordStream.hpp"
+#include <algorithm>
+
+namespace {
+    // "checkIn" values of a Reservations.json row
+    const char* const checkedInText = "checked In";
+    const char* const notCheckedInText = "not yet";
+}
 
 // ================================== Reservation Class =================================== //
 
 // Initialize static member++
-int Reservation::reservationCount = 0; 
+std::atomic<int> Reservation::reservationCount{0};
 
 // -------------------- Constructor -------------------- //
-Reservation::Reservation(int reservationId, const std::shared_ptr<Passenger>& p, const std::shared_ptr<Flight>& f, int s, 
-    std::string& method, std::string& details, int amount)
-    : reservationId(reservationId),passenger(p), flight(f), payment(method, details, amount), seatNum(s){
+Reservation::Reservation(int reservationId, std::shared_ptr<Passenger> p, std::shared_ptr<Flight> f, int s, 
+    const std::string& method, const std::string& details, int amount)
+    : reservationId(reservationId),passenger(std::move(p)), flight(std::move(f)), payment(method, details, amount), seatNum(s){
          ++reservationCount;
     }
 
@@ -43,6 +52,22 @@ void Reservation::modifyReservation(int resid, int s){
         std::cout<<" is modified with new seat number: "<<seatNum<<std::endl;
     }
 }
+// --------------------- Reservation as a Reservations.json row --------------------- //
+nlohmann::json Reservation::getReservationJson() const {
+    return {
+        {"reservationId", reservationId},
+        {"passengerid", passenger ? passenger->getId() : 0},
+        {"flightNumber", flight ? flight->getFlightNo() : 0},
+        {"seatNumber", seatNum},
+        {"checkIn", checkedIn ? checkedInText : notCheckedInText},
+        {"payment", {
+            {"method", payment.method.str()},
+            {"details", payment.details},
+            {"amount", payment.amount}
+        }}
+    };
+}
+
 // ---------------------- Cancel Reservation -------------------- //
 void Reservation::cancelReservation(){
     std::cout<<"Reservation ID: "<<reservationId;
@@ -54,116 +79,191 @@ void Reservation::cancelReservation(){
 // ================================== Reservation System Class ================================== // 
 
 // ---------------------------------- Default constructor ---------------------------------- //
-ReservationSystem::ReservationSystem(FlightSystem& fs, UserSystem& us)
-    : flightSystem(fs), userSystem(us)
+ReservationSystem::ReservationSystem(FlightSystem& fs, UserSystem& us, const SnapshotData* tables)
+    : reservationsJournal("Database/Reservations.json", "reservationId"), flightSystem(fs), userSystem(us)
 {
-    std::ifstream reservationsFile("Database/Reservations.json");
-    if (!reservationsFile.is_open())
-        throw std::runtime_error("Could not open Reservations.json");
-
-    nlohmann::json j;
-    reservationsFile >> j;
-
-    for (const auto& item : j) {
-        int resId               = item["reservationId"];
-        int pId                 = item["passengerid"];
-        int flightNum           = item["flightNumber"];
-        int seatNum             = item["seatNumber"];
-        std::string method      = item["payment"]["method"];
-        std::string details     = item["payment"]["details"];
-        int amount              = item["payment"]["amount"];
-
-        auto passenger = userSystem.getPassengerById(pId);
-        auto flight = flightSystem.getFlightByNumber(flightNum);
-
-        reservations.push_back(std::make_shared<Reservation>(
-            resId, passenger, flight, seatNum, method, details, amount));
+    if (tables) {
+        const std::vector<ReservationRecord>& records = tables->reservations;
+        reservations.reserve(records.size());
+        reservationsById.reserve(records.size());
+        reservationsByPassenger.reserve(records.size());
+        reservationsByFlight.reserve(records.size());
+        for (const auto& r : records) {
+            addReservation(r);
+        }
+    } else {
+        // Stream the file: each row becomes a Reservation as soon as it is parsed
+        streamReservationRecords("Database/Reservations.json", [this](ReservationRecord&& r) {
+            addReservation(r);
+        }, consoleProgress("reservations"));
     }
-}
 
+    // Re-apply changes journaled since the last checkpoint
+    reservationsJournal.replay([this](JournalOp op, const nlohmann::json& key, const nlohmann::json& row) {
+        if (op == JournalOp::put) {
+            eraseReservation(key);
+            addReservation(reservationRecordFromJson(row));
+        } else if (op == JournalOp::remove) {
+            eraseReservation(key);
+        } else if (Reservation* reservation = findReservation(key)) {
+            if (row.contains("seatNumber")) reservation->setSeatNo(row["seatNumber"]);
+            if (row.contains("checkIn")) reservation->checkedIn = row["checkIn"] == checkedInText;
+        }
+    });
+
+    rebuildSeatMaps();
+}
 
-// ------------------ Get Reservation by ID -------------------- //
-std::shared_ptr<Reservation> ReservationSystem::getReservationById(int resId) {
-    for (const auto& reservation : reservations) {
-        if (reservation->getReservationId() == resId) {
-            return reservation;
+// ------------------ Mark every reserved seat taken, one pass over the reservations -------------------- //
+void ReservationSystem::rebuildSeatMaps() {
+    for (const auto& flight : flightSystem.getFlights()) flight->getSeatMap().resetMap();
+
+    sharedSeats.clear();
+    int conflicts = 0;
+    reservations.forEach([&](const Reservation& reservation) {
+        Flight* flight = reservation.flight.get();
+        if (flight && !flight->getSeatMap().bookSeat(reservation.getSeatNo())) {
+            conflicts++;
+            sharedSeats[{flight->getFlightNo(), reservation.getSeatNo()}]++;
         }
+    });
+    sharedSeatCount = conflicts;
+    for (const auto& flight : flightSystem.getFlights()) flightSystem.syncSeats(*flight);
+    if (conflicts > 0)
+        std::cout << "Warning: " << conflicts << " reservation(s) have an invalid or already taken seat.\n";
+}
+
+// ------------------ Build a reservation from one Reservations.json row -------------------- //
+Reservation* ReservationSystem::addReservation(const ReservationRecord& r) {
+    Reservation* reservation = addReservation(r.reservationId, userSystem.getPassengerById(r.passengerId),
+                                              flightSystem.getFlightByNumber(r.flightNumber), r.seatNumber,
+                                              r.method, r.details, r.amount);
+    reservation->checkedIn = r.checkIn == checkedInText;    // loaders are single-threaded
+    return reservation;
+}
+
+// ------------------ Find Reservation by ID -------------------- //
+Reservation* ReservationSystem::lookupReservation(int resId) const {
+    auto it = reservationsById.find(resId);
+    return (it != reservationsById.end()) ? reservations.get(it->second) : nullptr;
+}
+
+Reservation* ReservationSystem::findReservation(int resId) const {
+    std::shared_lock<std::shared_mutex> lock(reservationsMutex);
+    return lookupReservation(resId); // nullptr if not found
+}
+
+// ------------------ Erase Reservation from memory and indexes -------------------- //
+void ReservationSystem::destroyReservation(std::unordered_map<int, PoolHandle>::iterator entry) {
+    if (const Reservation* reservation = reservations.get(entry->second)) {
+        if (reservation->passenger) reservationsByPassenger.erase(reservation->passenger->getId(), entry->second);
+        if (reservation->flight) reservationsByFlight.erase(reservation->flight->getFlightNo(), entry->second);
+        flightSystem.getMetrics().reservationRemoved(reservation->flight.get(), reservation->payment.amount);
     }
-    return nullptr; // Return nullptr if not found
+    reservations.destroy(entry->second);
+    reservationsById.erase(entry);
 }
 
+bool ReservationSystem::eraseReservation(int resId) {
+    std::unique_lock<std::shared_mutex> lock(reservationsMutex);
+    auto it = reservationsById.find(resId);
+    if (it == reservationsById.end()) return false;
+    destroyReservation(it);
+    return true;
+}
 
 // ---------------------- display Reservations of a passenger --------------------- //
 void ReservationSystem::displayReservations(int p_id) const {
-    bool found = false;
     int count =1;
 
     std::cout<< "You Reservations: " << std::endl;
-    for (const auto& reservation : reservations) {
-        if (reservation->getPassenger()->getId() == p_id) {
-            found = true;
-            std::cout << count++ << ". ";
-            reservation->displayReservation();
-            std::cout << "-----------------------\n";
-        }
+    auto mine = getReservationsOf(p_id);
+    for (const auto& reservation : mine) {
+        std::cout << count++ << ". ";
+        reservation->displayReservation();
+        std::cout << "-----------------------\n";
     }
-    if (!found) {
+    if (mine.empty()) {
         std::cout << "No reservations found for Passenger ID: " << p_id << std::endl;
     }
 }
 
+// --- O(k) in the passenger's own bookings through the passenger index, listed by reservation id :
+std::vector<Reservation*> ReservationSystem::getReservationsOf(int passengerId) const {
+    std::vector<Reservation*> result;
+    {
+        std::shared_lock<std::shared_mutex> lock(reservationsMutex);
+        result.reserve(reservationsByPassenger.count(passengerId));
+        reservationsByPassenger.forEach(passengerId, [&](PoolHandle handle) {
+            if (Reservation* reservation = reservations.get(handle)) result.push_back(reservation);
+        });
+    }
+    std::sort(result.begin(), result.end(), [](Reservation* a, Reservation* b) {
+        return a->getReservationId() < b->getReservationId();
+    });
+    return result;
+}
+
 // ----------------------- add Reservation -------------------------- //
-void ReservationSystem::addReservation(const std::shared_ptr<Reservation>& r){
-    // In‑memory list
-    reservations.push_back(r);
+Reservation* ReservationSystem::addReservation(int resId, std::shared_ptr<Passenger> passenger, std::shared_ptr<Flight> flight,
+                                               int seat, const std::string& method, const std::string& details, int amount){
+    std::unique_lock<std::shared_mutex> lock(reservationsMutex);
+    // Pool slot + id and passenger indexes
+    auto slot = reservationsById.emplace(resId, PoolHandle{});
+    if (!slot.second)
+        throw std::runtime_error("Duplicate reservation ID: " + std::to_string(resId));
+    const int passengerId = passenger ? passenger->getId() : 0;
+    const int flightNumber = flight ? flight->getFlightNo() : 0;
+    const bool hasPassenger = passenger != nullptr, hasFlight = flight != nullptr;
+    const Flight* flightOf = flight.get();
+    bool inPassengerIndex = false;
+    try {
+        slot.first->second = reservations.create(resId, std::move(passenger), std::move(flight), seat, method, details, amount);
+        if (hasPassenger) {
+            reservationsByPassenger.insert(passengerId, slot.first->second);
+            inPassengerIndex = true;
+        }
+        if (hasFlight) reservationsByFlight.insert(flightNumber, slot.first->second);
+    } catch (...) {
+        if (inPassengerIndex) reservationsByPassenger.erase(passengerId, slot.first->second);
+        if (slot.first->second) reservations.destroy(slot.first->second);
+        reservationsById.erase(slot.first);
+        throw;
+    }
+
+    flightSystem.getMetrics().reservationAdded(flightOf, amount);
+
+    // Keep the id counter past every id loaded or booked
+    int next = nextReservationId.load();
+    while (next <= resId && !nextReservationId.compare_exchange_weak(next, resId + 1)) {}
+    return reservations.get(slot.first->second);
 }
 
 // ------------------------ Remove Reservation --------------------- //
 void ReservationSystem::cancelReservation(int passengerId){
-  std::cout << "Enter your Reservation ID: ";
+    std::cout << "Enter your Reservation ID: ";
     int resId; std::cin >> resId;
-    for (auto it = reservations.begin(); it != reservations.end(); ++it) {
-        if ((*it)->getReservationId() == resId && (*it)->getPassenger()->getId() == passengerId) {
-            (*it)->cancelReservation();
-            reservations.erase(it);
-            std::cout << "Cancellation successful for Reservation ID: " << resId << std::endl;
-
-    // ---- Update JSON file ----
-    std::ifstream inFile("Database/Reservations.json");
-    nlohmann::json j; 
-    inFile >> j;
-    inFile.close();
-
-    // Remove the reservation from JSON
-    auto &arr = j;
-    for (auto jsonIt = arr.begin(); jsonIt != arr.end(); ++jsonIt) {
-        if ((*jsonIt)["reservationId"] == resId) {
-            arr.erase(jsonIt);
-            break;
-        }
-    }
-     std::ofstream outFile("Database/Reservations.json");
-            if (!outFile.is_open()) {
-                std::cerr << "Error writing to Reservations.json\n";
-                return;
-            }
-            outFile << std::setw(4) << j << std::endl;
-            outFile.close();
-
-            return;
-        }
+    Reservation* reservation = findReservation(resId);
+    if (reservation && reservation->getPassenger() && reservation->getPassenger()->getId() == passengerId) {
+        reservation->cancelReservation();   // prints the refund; cancelBooking frees the reservation
+        cancelBooking(resId);
+        std::cout << "Cancellation successful for Reservation ID: " << resId << std::endl;
+        return;
     }
     std::cout << "Reservation ID: " << resId << " not found or does not belong to you.\n";
+}
 
+// ---------------------- Record airport check-in --------------------- //
+bool ReservationSystem::recordCheckIn(int resId){
+    return checkIn({resId}).notFound.empty();
 }
 
 // ---------------------- Check Reservation --------------------- //
 std::optional<std::pair<std::string, std::string>> ReservationSystem::
     checkReservation(const int& p_id, const int& r_id){
-    for(const auto& reservation : reservations){
-        if(reservation->getReservationId() == r_id && reservation->getPassenger()->getId() == p_id){
-            return std::make_optional(std::make_pair(reservation->getFlight()->getFlightDetails(), std::to_string(reservation->getSeatNo())));
-        }
+    Reservation* reservation = findReservation(r_id);
+    if (reservation && reservation->getPassenger() && reservation->getPassenger()->getId() == p_id) {
+        return std::make_optional(std::make_pair(reservation->getFlight()->getFlightDetails(), std::to_string(reservation->getSeatNo())));
     }
     return std::nullopt;
 }
@@ -213,47 +313,103 @@ void ReservationSystem::BookByAgent(){
     std::getline(std::cin, input);
     amount = std::stoi(input);
 
-    int newReservationId = ++Reservation::reservationCount;
-    auto reservation = std::make_shared<Reservation>(newReservationId, passenger, flight, seatNum, method, details, amount);
-    reservations.push_back(reservation);
-    reservation->confirmReservation();
+    BookingResult result = book({passengerId, flightNum, seatNum, method, details, amount});
+    if (!result.ok()) {
+        std::cout << "Booking failed: " << bookingStatusToString(result.status) << ".\n";
+        return;
+    }
+    findReservation(result.reservationId)->confirmReservation();
     std::cout << "Booking completed.\n";
-
-    std::ifstream inFile("Database/Reservations.json");
-    nlohmann::json j;
-if (inFile.is_open()) {
-    inFile >> j;
-    inFile.close();
-} else {
-    std::cout << "Failed to open Reservations.json for reading.\n";
-    return;
-}
-
-// 2. Add the new reservation
-nlohmann::json newRes = {
-    {"reservationId", newReservationId},
-    {"passengerid", passenger->getId()},
-    {"flightNumber", flight->getFlightNo()},
-    {"seatNumber", seatNum},
-    {"checkIn", "not yet"},
-     {"payment", {
-        {"method", method},
-        {"details", details},
-        {"amount", amount}
-    }}
-};
-
-j.push_back(newRes);
-
-// 3. Write back to the file
-std::ofstream outFile("Database/Reservations.json");
-if (outFile.is_open()) {
-    outFile << j.dump(4);
-    outFile.close();
     std::cout << "Reservation saved to file.\n";
-} else {
-    std::cout << "Failed to open Reservations.json for writing.\n";
 }
+
+// ----------------------------- Book (thread-safe, no prompts) ---------------------------------- //
+// The seat is claimed on the flight's SeatMap under that flight's lock stripe, so two bookings
+// only contend when their flights share a stripe. Reservation ids come from an atomic counter
+// and the journal batches concurrent appends into one fsync (group commit).
+BookingResult ReservationSystem::book(const BookingRequest& request) {
+    BookingResult result;
+    auto passenger = userSystem.getPassengerById(request.passengerId);
+    if (!passenger) {
+        result.status = BookingStatus::unknownPassenger;
+        return result;
+    }
+    auto flight = flightSystem.getFlightByNumber(request.flightNumber);
+    if (!flight) {
+        result.status = BookingStatus::unknownFlight;
+        return result;
+    }
+
+    std::mutex& flightLock = flightLocks.forKey(flight->getFlightNo());
+    {
+        std::lock_guard<std::mutex> lock(flightLock);
+        SeatMap& seats = flight->getSeatMap();
+        int seat = request.seatNumber;
+        if (seat == 0) {
+            seat = seats.firstFreeSeat();
+            if (seat == 0) {
+                result.status = BookingStatus::flightFull;
+                return result;
+            }
+        } else if (seat < 1 || seat > seats.getTotalSeats()) {
+            result.status = BookingStatus::invalidSeat;
+            return result;
+        }
+        if (!seats.bookSeat(seat)) {
+            result.status = BookingStatus::seatTaken;
+            return result;
+        }
+        flightSystem.syncSeats(*flight);
+        result.seatNumber = seat;
+    }
+
+    int resId = nextReservationId++;
+    bool inserted = false;
+    try {
+        nlohmann::json row = addReservation(resId, std::move(passenger), flight, result.seatNumber,
+                                            request.method, request.details, request.amount)->getReservationJson();
+        inserted = true;
+        reservationsJournal.put(row);
+    } catch (...) {
+        // Not durable: give the seat and the id back. Only erase what this call inserted; if
+        // addReservation threw (say the id was taken) the reservation under resId is someone else's
+        if (inserted) eraseReservation(resId);
+        std::lock_guard<std::mutex> lock(flightLock);
+        flight->getSeatMap().unbookSeat(result.seatNumber);
+        flightSystem.syncSeats(*flight);
+        throw;
+    }
+    result.reservationId = resId;
+    return result;
+}
+
+// ----------------------------- Cancel (thread-safe, no prompts) ---------------------------------- //
+bool ReservationSystem::cancelBooking(int resId) {
+    {
+        std::shared_lock<std::shared_mutex> lock(reservationsMutex);
+        if (!lookupReservation(resId)) return false;
+    }
+    // Durable first, as in book(): if the journal write throws, memory still matches the disk.
+    // Removes are idempotent, so a concurrent cancel of the same id journaling it too is harmless
+    reservationsJournal.remove(resId);
+
+    std::shared_ptr<Flight> flight;
+    int seat = 0;
+    {
+        std::unique_lock<std::shared_mutex> lock(reservationsMutex);
+        auto it = reservationsById.find(resId);
+        if (it == reservationsById.end()) return false;     // cancelled by another thread meanwhile
+        Reservation* reservation = reservations.get(it->second);
+        flight = reservation->getFlight();
+        seat = reservation->getSeatNo();
+        destroyReservation(it);
+    }
+
+    if (flight) {
+        std::lock_guard<std::mutex> lock(flightLocks.forKey(flight->getFlightNo()));
+        releaseSeat(*flight, seat);
+    }
+    return true;
 }
 
 // ----------------------------- Remove booking  ---------------------------------- //
@@ -263,38 +419,12 @@ void ReservationSystem::removeBooking() {
     int resId;
     std::cin >> resId;
 
-    for (auto it = reservations.begin(); it != reservations.end(); ++it) {
-        if ((*it)->getReservationId() == resId) {
-            // Cancel and remove from memory
-            (*it)->cancelReservation();
-            reservations.erase(it);
-            std::cout << "Cancellation successful for Reservation ID: " << resId << std::endl;
-
-            // Now update the JSON file
-            std::ifstream inFile("Database/Reservations.json");
-
-            nlohmann::json j;
-            inFile >> j;
-            inFile.close();
-
-            // Remove the reservation from JSON
-            auto &arr = j;
-            for (auto jsonIt = arr.begin(); jsonIt != arr.end(); ++jsonIt) {
-                if ((*jsonIt)["reservationId"] == resId) {
-                    arr.erase(jsonIt);
-                    break;
-                }
-            }
-            // Write back to file
-            std::ofstream outFile("Database/Reservations.json");
-            if (!outFile.is_open()) {
-                std::cerr << "Error writing to Reservations.json\n";
-                return;
-            }
-            outFile << std::setw(4) << j << std::endl;
-            outFile.close();
-            return;
-        }
+    Reservation* reservation = findReservation(resId);
+    if (reservation) {
+        reservation->cancelReservation();   // prints the refund; cancelBooking frees the reservation
+        cancelBooking(resId);
+        std::cout << "Cancellation successful for Reservation ID: " << resId << std::endl;
+        return;
     }
     std::cout << "Reservation ID: " << resId << " not found.\n";
 }
@@ -309,40 +439,166 @@ void ReservationSystem::modifyBooking() {
     int newSeat;
     std::cin >> newSeat;
 
-    for (const auto& reservation : reservations) {
-        if (reservation->getReservationId() == resId) {
-            // Modify the reservation in memory
-            reservation->modifyReservation(resId, newSeat);
-            std::cout << "Modification successful for Reservation ID: " << resId << std::endl;
-
-            // ---- Update JSON file ----
-            std::ifstream inFile("Database/Reservations.json");
-
-            nlohmann::json j;
-            inFile >> j;
-            inFile.close();
-
-            // Find and update the matching reservation
-            for (auto& item : j) {
-                if (item["reservationId"] == resId) {
-                    item["seatNumber"] = newSeat;
-                    break;
-                }
-            }
+    BookingResult result = changeSeat(resId, newSeat);
+    if (result.ok()) {
+        std::cout << "Reservation ID: " << resId << " is modified with new seat number: " << newSeat << std::endl;
+        std::cout << "Modification successful for Reservation ID: " << resId << std::endl;
+        return;
+    }
+    std::cout << "Modification failed for Reservation ID " << resId << ": " << bookingStatusToString(result.status) << ".\n";
+}
 
-            // Write updated JSON back to file
-            std::ofstream outFile("Database/Reservations.json");
-            if (!outFile.is_open()) {
-                std::cerr << "Error writing to Reservations.json\n";
-                return;
+// --- Called under the flight's lock stripe: a seat another loaded reservation also holds stays taken :
+void ReservationSystem::releaseSeat(Flight& flight, int seat) {
+    if (sharedSeatCount > 0) {
+        std::lock_guard<std::mutex> lock(sharedSeatsMutex);
+        auto it = sharedSeats.find({flight.getFlightNo(), seat});
+        if (it != sharedSeats.end()) {
+            if (--it->second == 0) sharedSeats.erase(it);
+            --sharedSeatCount;
+            return;
+        }
+    }
+    flight.getSeatMap().unbookSeat(seat);
+    flightSystem.syncSeats(flight);
+}
+
+// ----------------------------- Change seat (thread-safe, no prompts) ---------------------------------- //
+// The new seat is claimed before the old one is released, both under the flight's lock stripe.
+// The reservation list stays read-locked throughout so a concurrent cancel cannot free it.
+// The patch is journaled while the stripe is still held, so concurrent changes reach the journal
+// in the order they were applied; if it fails the new seat is given back and nothing changes.
+BookingResult ReservationSystem::changeSeat(int resId, int newSeat) {
+    BookingResult result;
+    result.reservationId = resId;
+    std::shared_lock<std::shared_mutex> reservationsLock(reservationsMutex);
+    Reservation* reservation = lookupReservation(resId);
+    if (!reservation) {
+        result.status = BookingStatus::unknownReservation;
+        return result;
+    }
+    Flight* flight = reservation->flight.get();
+    if (!flight) {
+        result.status = BookingStatus::unknownFlight;
+        return result;
+    }
+
+    std::lock_guard<std::mutex> lock(flightLocks.forKey(flight->getFlightNo()));
+    SeatMap& seats = flight->getSeatMap();
+    int oldSeat = reservation->getSeatNo();
+    if (newSeat < 1 || newSeat > seats.getTotalSeats()) {
+        result.status = BookingStatus::invalidSeat;
+        return result;
+    }
+    result.seatNumber = newSeat;
+    if (newSeat == oldSeat) return result;
+    if (!seats.bookSeat(newSeat)) {
+        result.status = BookingStatus::seatTaken;
+        return result;
+    }
+    try {
+        reservationsJournal.patch(resId, {{"seatNumber", newSeat}});
+    } catch (...) {
+        // Not durable: the reservation keeps its old seat
+        seats.unbookSeat(newSeat);
+        flightSystem.syncSeats(*flight);
+        throw;
+    }
+    releaseSeat(*flight, oldSeat);
+    flightSystem.syncSeats(*flight);
+    reservation->setSeatNo(newSeat);
+    return result;
+}
+
+int ReservationSystem::availableSeats(const Flight& flight) {
+    std::lock_guard<std::mutex> lock(flightLocks.forKey(flight.getFlightNo()));
+    return flight.availableSeats();
+}
+
+// ----------------------------- Flight manifest (thread-safe, no prompts) ---------------------------------- //
+// O(passengers on the flight) through the flight index. Seats are read under the flight's lock
+// stripe (taken after reservationsMutex, the same order as changeSeat) so a seat change is either
+// fully in the manifest or not at all.
+std::vector<ManifestEntry> ReservationSystem::getManifest(int flightNumber) const {
+    std::vector<ManifestEntry> manifest;
+    {
+        std::shared_lock<std::shared_mutex> lock(reservationsMutex);
+        std::lock_guard<std::mutex> seatsLock(flightLocks.forKey(flightNumber));
+        manifest.reserve(reservationsByFlight.count(flightNumber));
+        reservationsByFlight.forEach(flightNumber, [&](PoolHandle handle) {
+            const Reservation* reservation = reservations.get(handle);
+            if (!reservation) return;
+            ManifestEntry entry;
+            entry.seatNumber = reservation->seatNum;
+            entry.reservationId = reservation->reservationId;
+            entry.checkedIn = reservation->checkedIn;
+            if (reservation->passenger) {
+                entry.passengerId = reservation->passenger->getId();
+                entry.passengerName = reservation->passenger->getUserName();
             }
+            manifest.push_back(std::move(entry));
+        });
+    }
+    std::sort(manifest.begin(), manifest.end(), [](const ManifestEntry& a, const ManifestEntry& b) {
+        return a.seatNumber != b.seatNumber ? a.seatNumber < b.seatNumber : a.reservationId < b.reservationId;
+    });
+    return manifest;
+}
 
-            outFile << std::setw(4) << j << std::endl;
-            outFile.close();
+std::size_t ReservationSystem::manifestSize(int flightNumber) const {
+    std::shared_lock<std::shared_mutex> lock(reservationsMutex);
+    return reservationsByFlight.count(flightNumber);
+}
 
-            return;
+// ----------------------------- Batch check-in (thread-safe, no prompts) ---------------------------------- //
+// Candidates are collected under the exclusive lock and journaled as patches behind a single
+// fsync; the flags flip only once that write is durable, so MANIFEST and boarding passes never
+// show a check-in a crash would lose. If the write fails nothing changes and the error propagates.
+CheckInResult ReservationSystem::checkIn(const std::vector<int>& resIds) {
+    CheckInResult result;
+    std::unique_lock<std::shared_mutex> lock(reservationsMutex);
+    std::vector<Reservation*> pending;
+    for (int resId : resIds) {
+        Reservation* reservation = lookupReservation(resId);
+        if (!reservation) {
+            result.notFound.push_back(resId);
+        } else if (reservation->checkedIn ||
+                   std::find(pending.begin(), pending.end(), reservation) != pending.end()) {
+            result.alreadyCheckedIn.push_back(resId);
+        } else {
+            pending.push_back(reservation);
+            result.checkedIn.push_back(resId);
         }
     }
+    journalCheckIns(result.checkedIn);
+    for (Reservation* reservation : pending) reservation->checkedIn = true;
+    return result;
+}
 
-    std::cout << "Reservation ID: " << resId << " not found.\n";
+// --- Everyone on the flight, found through the flight index :
+CheckInResult ReservationSystem::checkInFlight(int flightNumber) {
+    CheckInResult result;
+    std::unique_lock<std::shared_mutex> lock(reservationsMutex);
+    std::vector<Reservation*> pending;
+    reservationsByFlight.forEach(flightNumber, [&](PoolHandle handle) {
+        Reservation* reservation = reservations.get(handle);
+        if (!reservation) return;
+        if (reservation->checkedIn) {
+            result.alreadyCheckedIn.push_back(reservation->reservationId);
+        } else {
+            pending.push_back(reservation);
+            result.checkedIn.push_back(reservation->reservationId);
+        }
+    });
+    journalCheckIns(result.checkedIn);
+    for (Reservation* reservation : pending) reservation->checkedIn = true;
+    return result;
+}
+
+// --- Caller holds reservationsMutex exclusively; throws if the batch did not reach disk :
+void ReservationSystem::journalCheckIns(const std::vector<int>& resIds) {
+    if (resIds.empty()) return;
+    Journal::Batch batch(reservationsJournal);
+    for (int resId : resIds) batch.patch(resId, {{"checkIn", checkedInText}});
+    batch.commit();
 }
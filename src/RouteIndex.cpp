@@ -0,0 +1,81 @@
+#include "../Include/RouteIndex.hpp"
+#include "../Include/Flight.hpp"
+#include <climits>
+#include <tuple>
+
+// ===================================== RouteKey ===================================== //
+bool RouteKey::operator<(const RouteKey& other) const {
+    return std::tie(origin, destination, day) < std::tie(other.origin, other.destination, other.day);
+}
+
+// ===================================== RouteIndex Class ===================================== //
+
+// --- File a flight under its route and departure day :
+void RouteIndex::insert(const std::shared_ptr<Flight>& flight) {
+    if (!flight) return;
+    RouteKey key{flight->getOriginId(), flight->getDestinationId(), flight->getDepartureDay()};
+    buckets[key].push_back(flight);
+    keysByFlight[flight->getFlightNo()] = std::move(key);
+}
+
+// --- Remove a flight using the key it was filed under :
+void RouteIndex::erase(int flightNumber) {
+    auto keyIt = keysByFlight.find(flightNumber);
+    if (keyIt == keysByFlight.end()) return;
+
+    auto bucketIt = buckets.find(keyIt->second);
+    if (bucketIt != buckets.end()) {
+        auto& list = bucketIt->second;
+        for (auto it = list.begin(); it != list.end(); ++it) {
+            if ((*it)->getFlightNo() == flightNumber) {
+                list.erase(it);
+                break;
+            }
+        }
+        if (list.empty()) buckets.erase(bucketIt);
+    }
+    keysByFlight.erase(keyIt);
+}
+
+void RouteIndex::update(const std::shared_ptr<Flight>& flight) {
+    if (!flight) return;
+    erase(flight->getFlightNo());
+    insert(flight);
+}
+
+void RouteIndex::clear() {
+    buckets.clear();
+    keysByFlight.clear();
+}
+
+// --- Flights on one route and one day :
+RouteIndex::FlightList RouteIndex::find(Symbol origin, Symbol destination, int day) const {
+    auto it = buckets.find(RouteKey{origin, destination, day});
+    return (it != buckets.end()) ? it->second : FlightList{};
+}
+
+// --- Flights on one route departing in [firstDay, lastDay], ordered by day :
+RouteIndex::FlightList RouteIndex::findInRange(Symbol origin, Symbol destination, int firstDay, int lastDay) const {
+    FlightList result;
+    if (firstDay > lastDay) return result;
+    auto end = buckets.upper_bound(RouteKey{origin, destination, lastDay});
+    for (auto it = buckets.lower_bound(RouteKey{origin, destination, firstDay}); it != end; ++it)
+        result.insert(result.end(), it->second.begin(), it->second.end());
+    return result;
+}
+
+// --- Flights from an origin to any destination in [firstDay, lastDay] :
+// jumps straight to the day range of each destination instead of walking every day.
+RouteIndex::FlightList RouteIndex::findFrom(Symbol origin, int firstDay, int lastDay) const {
+    FlightList result;
+    if (firstDay > lastDay) return result;
+    auto it = buckets.lower_bound(RouteKey{origin, Symbol(), INT_MIN});
+    while (it != buckets.end() && it->first.origin == origin) {
+        const Symbol destination = it->first.destination;
+        auto rangeEnd = buckets.upper_bound(RouteKey{origin, destination, lastDay});
+        for (it = buckets.lower_bound(RouteKey{origin, destination, firstDay}); it != rangeEnd; ++it)
+            result.insert(result.end(), it->second.begin(), it->second.end());
+        it = buckets.upper_bound(RouteKey{origin, destination, INT_MAX});
+    }
+    return result;
+}
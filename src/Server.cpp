@@ -0,0 +1,389 @@
+#include "../Include/Server.hpp"
+#include "../Include/Flight.hpp"
+#include "../Include/Reservation.hpp"
+#include <iterator>
+#include <sstream>
+#include <stdexcept>
+
+#if defined(__linux__)
+    #include <arpa/inet.h>
+    #include <cerrno>
+    #include <csignal>
+    #include <cstring>
+    #include <fcntl.h>
+    #include <netinet/in.h>
+    #include <netinet/tcp.h>
+    #include <sys/epoll.h>
+    #include <sys/eventfd.h>
+    #include <sys/socket.h>
+    #include <unistd.h>
+#endif
+
+namespace {
+    const std::size_t maxLineLength = 64 * 1024;     // longer requests close the connection
+
+    std::atomic<BookingServer*> signalTarget{nullptr};
+
+    // --- Only async-signal-safe work here: the event loop does the rest once it is woken :
+    void onStopSignal(int) {
+        if (BookingServer* server = signalTarget.load()) server->requestStop();
+    }
+
+    // --- The request's first token, as handle() dispatches on it :
+    std::string commandOf(const std::string& line) {
+        std::istringstream in(line);
+        std::string command;
+        in >> command;
+        return command;
+    }
+
+    std::string trim(const std::string& s) {
+        std::size_t first = s.find_first_not_of(" \t");
+        if (first == std::string::npos) return "";
+        return s.substr(first, s.find_last_not_of(" \t") - first + 1);
+    }
+}
+
+// ===================================== BookingServer Class ===================================== //
+
+BookingServer::BookingServer(FlightSystem& fs, ReservationSystem& rs, int port, int workers)
+    : flightSystem(fs), reservationSystem(rs), port(port), workerCount(workers > 0 ? workers : 1) {}
+
+BookingServer::~BookingServer() {
+    stop();
+    for (auto& worker : workers) {
+        if (worker.joinable()) worker.join();
+    }
+}
+
+// ---------------------------- Protocol ---------------------------- //
+std::string BookingServer::handle(const std::string& line) {
+    std::istringstream in(line);
+    std::string command;
+    in >> command;
+
+    if (command == "PING") return "OK PONG";
+    if (command == "QUIT") return "OK BYE";
+
+    if (command == "SEARCH") {
+        std::string orig, dest, date;
+        if (!(in >> orig >> dest >> date)) return "ERR usage: SEARCH <origin> <destination|*> <YYYY-MM-DD>";
+        int day;
+        try {
+            day = toUtcDay(parseDate(date));
+        } catch (...) {
+            return "ERR invalid date";
+        }
+        auto matches = (dest == "*") ? flightSystem.findFlightsFrom(orig, day, day) : flightSystem.findFlights(orig, dest, day);
+        std::string response = "OK " + std::to_string(matches.size());
+        for (const auto& flight : matches)
+            response += " " + std::to_string(flight->getFlightNo()) + ":" + std::to_string(reservationSystem.availableSeats(*flight));
+        return response;
+    }
+
+    if (command == "BOOK") {
+        BookingRequest request;
+        if (!(in >> request.passengerId >> request.flightNumber >> request.seatNumber >> request.amount))
+            return "ERR usage: BOOK <passengerId> <flight> <seat|0> <amount> <method>";
+        std::getline(in, request.method);
+        request.method = trim(request.method);
+        if (request.method.empty()) request.method = "Cash";
+        request.details = "server";
+        BookingResult result = reservationSystem.book(request);
+        if (!result.ok()) return "ERR " + bookingStatusToString(result.status);
+        return "OK " + std::to_string(result.reservationId) + " " + std::to_string(result.seatNumber);
+    }
+
+    if (command == "SEAT") {
+        int resId, seat;
+        if (!(in >> resId >> seat)) return "ERR usage: SEAT <reservationId> <newSeat>";
+        BookingResult result = reservationSystem.changeSeat(resId, seat);
+        if (!result.ok()) return "ERR " + bookingStatusToString(result.status);
+        return "OK " + std::to_string(resId) + " " + std::to_string(result.seatNumber);
+    }
+
+    if (command == "CANCEL") {
+        int resId;
+        if (!(in >> resId)) return "ERR usage: CANCEL <reservationId>";
+        return reservationSystem.cancelBooking(resId) ? "OK" : "ERR reservation not found";
+    }
+
+    if (command == "CHECKIN") {
+        std::string first;
+        if (!(in >> first)) return "ERR usage: CHECKIN <reservationId> ... | CHECKIN FLIGHT <flight>";
+        CheckInResult result;
+        if (first == "FLIGHT") {
+            int flightNumber;
+            if (!(in >> flightNumber)) return "ERR usage: CHECKIN FLIGHT <flight>";
+            if (!flightSystem.getFlightByNumber(flightNumber)) return "ERR flight not found";
+            result = reservationSystem.checkInFlight(flightNumber);
+        } else {
+            std::vector<int> ids;
+            std::istringstream all(first + " " + std::string(std::istreambuf_iterator<char>(in), {}));
+            for (int id; all >> id;) ids.push_back(id);
+            if (!all.eof()) return "ERR usage: CHECKIN <reservationId> ... | CHECKIN FLIGHT <flight>";
+            result = reservationSystem.checkIn(ids);
+        }
+        return "OK " + std::to_string(result.checkedIn.size()) + " " + std::to_string(result.alreadyCheckedIn.size())
+             + " " + std::to_string(result.notFound.size());
+    }
+
+    if (command == "MANIFEST") {
+        int flightNumber;
+        if (!(in >> flightNumber)) return "ERR usage: MANIFEST <flight>";
+        if (!flightSystem.getFlightByNumber(flightNumber)) return "ERR flight not found";
+        auto manifest = reservationSystem.getManifest(flightNumber);
+        std::string response = "OK " + std::to_string(manifest.size());
+        for (const auto& entry : manifest) {
+            response += " " + std::to_string(entry.seatNumber) + ":" + std::to_string(entry.reservationId)
+                      + ":" + std::to_string(entry.passengerId);
+        }
+        return response;
+    }
+
+    return "ERR unknown command";
+}
+
+// ---------------------------- Worker pool ---------------------------- //
+void BookingServer::workerLoop() {
+    while (true) {
+        Job job;
+        {
+            std::unique_lock<std::mutex> lock(jobsMutex);
+            jobsReady.wait(lock, [this] { return stopping || !jobs.empty(); });
+            if (stopping) return;
+            job = std::move(jobs.front());
+            jobs.pop_front();
+        }
+
+        std::string response;
+        try {
+            response = handle(job.line);
+        } catch (const std::exception& e) {
+            response = std::string("ERR internal error: ") + e.what();
+        }
+        bool quit = commandOf(job.line) == "QUIT";
+        {
+            std::lock_guard<std::mutex> lock(doneMutex);
+            done.push_back({job.fd, std::move(response), quit});
+        }
+        wake();
+    }
+}
+
+// --- Hand the connection's next request to the workers (event loop thread) :
+void BookingServer::dispatch(int fd, Connection& c) {
+    if (c.busy || c.pending.empty()) return;
+    c.busy = true;
+    {
+        std::lock_guard<std::mutex> lock(jobsMutex);
+        jobs.push_back({fd, std::move(c.pending.front())});
+    }
+    c.pending.pop_front();
+    jobsReady.notify_one();
+}
+
+void BookingServer::requestStop() {
+    stopping = true;
+    wake();
+}
+
+void BookingServer::stop() {
+    requestStop();
+    {
+        std::lock_guard<std::mutex> lock(jobsMutex);    // a worker between its predicate check and wait() cannot miss this
+    }
+    jobsReady.notify_all();
+}
+
+#if defined(__linux__)
+
+void BookingServer::wake() {
+    if (wakeFd < 0) return;
+    std::uint64_t one = 1;
+    ssize_t written = write(wakeFd, &one, sizeof(one));     // async-signal-safe, used by requestStop
+    (void)written;
+}
+
+// ---------------------------- Event loop ---------------------------- //
+void BookingServer::run() {
+    listenFd = socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    if (listenFd < 0) throw std::runtime_error("socket() failed");
+    int yes = 1;
+    setsockopt(listenFd, SOL_SOCKET, SO_REUSEADDR, &yes, sizeof(yes));
+
+    sockaddr_in addr{};
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(static_cast<std::uint16_t>(port));
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);          // local clients only
+    if (bind(listenFd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) < 0 || listen(listenFd, SOMAXCONN) < 0) {
+        close(listenFd);
+        throw std::runtime_error("Could not listen on port " + std::to_string(port) + ": " + std::strerror(errno));
+    }
+
+    epollFd = epoll_create1(EPOLL_CLOEXEC);
+    wakeFd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    epoll_event ev{};
+    ev.events = EPOLLIN;
+    ev.data.fd = listenFd;
+    epoll_ctl(epollFd, EPOLL_CTL_ADD, listenFd, &ev);
+    ev.data.fd = wakeFd;
+    epoll_ctl(epollFd, EPOLL_CTL_ADD, wakeFd, &ev);
+
+    signalTarget = this;
+    std::signal(SIGINT, onStopSignal);
+    std::signal(SIGTERM, onStopSignal);
+    std::signal(SIGPIPE, SIG_IGN);
+
+    for (int i = 0; i < workerCount; i++) workers.emplace_back(&BookingServer::workerLoop, this);
+    std::cout << "Serving on 127.0.0.1:" << port << " with " << workerCount << " workers (Ctrl+C to stop)\n";
+
+    std::vector<epoll_event> events(256);
+    while (!stopping) {
+        int n = epoll_wait(epollFd, events.data(), static_cast<int>(events.size()), -1);
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            break;
+        }
+        for (int i = 0; i < n; i++) {
+            int fd = events[i].data.fd;
+            if (fd == listenFd) {
+                acceptClients();
+            } else if (fd == wakeFd) {
+                std::uint64_t count;
+                while (read(wakeFd, &count, sizeof(count)) > 0) {}
+                collectDone();
+            } else {
+                if (events[i].events & (EPOLLIN | EPOLLRDHUP | EPOLLHUP | EPOLLERR)) readClient(fd);
+                if (connections.count(fd) && (events[i].events & EPOLLOUT)) flushClient(fd);
+            }
+        }
+    }
+
+    // --- Shut down: workers first (they still reference connections by fd), then the sockets.
+    //     A signal only set stopping and woke the loop; the workers are notified here
+    stop();
+    for (auto& worker : workers) worker.join();
+    workers.clear();
+    for (auto& entry : connections) close(entry.first);
+    connections.clear();
+    signalTarget = nullptr;
+    close(listenFd);
+    close(epollFd);
+    close(wakeFd);
+    listenFd = epollFd = wakeFd = -1;
+    std::cout << "Server stopped.\n";
+}
+
+void BookingServer::acceptClients() {
+    while (true) {
+        int fd = accept4(listenFd, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC);
+        if (fd < 0) return;     // EAGAIN: all pending connections accepted
+        int yes = 1;
+        setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &yes, sizeof(yes));
+
+        epoll_event ev{};
+        ev.events = EPOLLIN | EPOLLOUT | EPOLLRDHUP | EPOLLET;
+        ev.data.fd = fd;
+        epoll_ctl(epollFd, EPOLL_CTL_ADD, fd, &ev);
+        connections[fd] = Connection();
+    }
+}
+
+// --- Edge-triggered: read until EAGAIN, then queue every complete line. Lines that arrived before
+//     the peer's EOF are still answered; closing only stops further reads :
+void BookingServer::readClient(int fd) {
+    Connection& c = connections[fd];
+    char buffer[16 * 1024];
+    while (!c.closing) {
+        ssize_t n = recv(fd, buffer, sizeof(buffer), 0);
+        if (n > 0) {
+            c.in.append(buffer, static_cast<std::size_t>(n));
+            continue;
+        }
+        if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) break;
+        if (n < 0 && errno == EINTR) continue;
+        c.closing = true;       // peer closed or error
+        break;
+    }
+
+    std::size_t start = 0, end;
+    while ((end = c.in.find('\n', start)) != std::string::npos) {
+        std::string line = c.in.substr(start, end - start);
+        if (!line.empty() && line.back() == '\r') line.pop_back();
+        if (!line.empty()) c.pending.push_back(std::move(line));
+        start = end + 1;
+    }
+    c.in.erase(0, start);
+    if (c.in.size() > maxLineLength) {
+        c.out += "ERR request too long\n";
+        c.pending.clear();
+        c.closing = true;
+    }
+
+    dispatch(fd, c);
+    flushClient(fd);
+}
+
+void BookingServer::flushClient(int fd) {
+    Connection& c = connections[fd];
+    while (!c.out.empty()) {
+        ssize_t n = send(fd, c.out.data(), c.out.size(), MSG_NOSIGNAL);
+        if (n > 0) {
+            c.out.erase(0, static_cast<std::size_t>(n));
+        } else if (n < 0 && errno == EINTR) {
+            continue;
+        } else if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+            return;             // EPOLLOUT fires when the socket drains
+        } else {
+            c.out.clear();      // peer gone
+            c.pending.clear();
+            c.closing = true;
+        }
+    }
+    closeIfFinished(fd);
+}
+
+// --- A connection is only closed once its queued requests are answered and no worker holds one of them,
+//     so its fd cannot be reused under a worker :
+void BookingServer::closeIfFinished(int fd) {
+    auto it = connections.find(fd);
+    if (it == connections.end()) return;
+    const Connection& c = it->second;
+    if (!c.closing || c.busy || !c.pending.empty() || !c.out.empty()) return;
+    epoll_ctl(epollFd, EPOLL_CTL_DEL, fd, nullptr);
+    close(fd);
+    connections.erase(it);
+}
+
+void BookingServer::collectDone() {
+    std::vector<Done> finished;
+    {
+        std::lock_guard<std::mutex> lock(doneMutex);
+        finished.swap(done);
+    }
+    for (auto& d : finished) {
+        auto it = connections.find(d.fd);
+        if (it == connections.end()) continue;
+        Connection& c = it->second;
+        c.busy = false;
+        c.out += d.response;
+        c.out += '\n';
+        if (d.quit) {
+            c.pending.clear();
+            c.closing = true;
+        }
+        dispatch(d.fd, c);
+        flushClient(d.fd);
+    }
+}
+
+#else
+
+void BookingServer::wake() {}
+
+void BookingServer::run() {
+    throw std::runtime_error("Serve mode is only available on Linux (epoll).");
+}
+
+#endif
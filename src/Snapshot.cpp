@@ -0,0 +1,445 @@
+#include "../Include/Snapshot.hpp"
+#include "../Include/Persistence.hpp"
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <stdexcept>
+#include <unordered_map>
+#include <sys/stat.h>
+
+#if defined(_WIN32)
+    #include <windows.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <unistd.h>
+#endif
+
+const char* const snapshotSourceFiles[static_cast<int>(SnapshotSource::count)] = {
+    "database/Aircrafts.json",
+    "database/Crew.json",
+    "database/Users.json",
+    "database/Flights.json",
+    "Database/Reservations.json"
+};
+
+namespace {
+    const char snapshotMagic[8] = {'A', 'R', 'S', 'N', 'A', 'P', '\0', '\0'};
+
+    static_assert(sizeof(SnapAircraft) == 32, "snapshot record layout changed, bump snapshotVersion");
+    static_assert(sizeof(SnapCrew) == 32, "snapshot record layout changed, bump snapshotVersion");
+    static_assert(sizeof(SnapUser) == 32, "snapshot record layout changed, bump snapshotVersion");
+    static_assert(sizeof(SnapFlight) == 56, "snapshot record layout changed, bump snapshotVersion");
+    static_assert(sizeof(SnapReservation) == 48, "snapshot record layout changed, bump snapshotVersion");
+
+    std::int64_t toSeconds(const timeType& tp) {
+        return std::chrono::duration_cast<std::chrono::seconds>(tp.time_since_epoch()).count();
+    }
+
+    timeType fromSeconds(std::int64_t s) {
+        return timeType(std::chrono::seconds(s));
+    }
+
+    // --- Size, modification time to the nanosecond and file id: a rewrite within the same second
+    // --- keeping the size still shows, and so does a file replaced by rename :
+    SnapSource sourceStamp(const char* path) {
+        SnapSource stamp{};
+#if defined(_WIN32)
+        WIN32_FILE_ATTRIBUTE_DATA info;
+        if (!GetFileAttributesExA(path, GetFileExInfoStandard, &info)) return stamp;
+        const std::uint64_t ticks = (std::uint64_t(info.ftLastWriteTime.dwHighDateTime) << 32) | info.ftLastWriteTime.dwLowDateTime;
+        stamp.size = (std::uint64_t(info.nFileSizeHigh) << 32) | info.nFileSizeLow;
+        stamp.mtime = static_cast<std::int64_t>(ticks / 10000000);
+        stamp.mtimeNanos = static_cast<std::uint32_t>(ticks % 10000000) * 100;
+#else
+        struct stat st{};
+        if (stat(path, &st) != 0) return stamp;
+        stamp.size = static_cast<std::uint64_t>(st.st_size);
+        stamp.fileId = static_cast<std::uint64_t>(st.st_ino);
+#if defined(__APPLE__)
+        stamp.mtime = static_cast<std::int64_t>(st.st_mtimespec.tv_sec);
+        stamp.mtimeNanos = static_cast<std::uint32_t>(st.st_mtimespec.tv_nsec);
+#else
+        stamp.mtime = static_cast<std::int64_t>(st.st_mtim.tv_sec);
+        stamp.mtimeNanos = static_cast<std::uint32_t>(st.st_mtim.tv_nsec);
+#endif
+#endif
+        return stamp;
+    }
+
+    bool sameStamp(const SnapSource& a, const SnapSource& b) {
+        return a.size == b.size && a.mtime == b.mtime && a.mtimeNanos == b.mtimeNanos && a.fileId == b.fileId;
+    }
+
+    // --- Accumulates the output file: sections are appended in order, strings deduplicated :
+    class SnapshotWriter {
+    private:
+        std::string out;
+        std::string strings;
+        std::unordered_map<std::string, SnapStr> stringIds;
+        SnapshotHeader head{};
+
+        void align() { out.resize((out.size() + 7) & ~std::size_t(7), '\0'); }
+
+    public:
+        SnapshotWriter() {
+            std::memcpy(head.magic, snapshotMagic, sizeof(snapshotMagic));
+            head.version = snapshotVersion;
+            head.headerSize = sizeof(SnapshotHeader);
+            out.resize(sizeof(SnapshotHeader));
+        }
+
+        SnapStr str(const std::string& s) {
+            auto it = stringIds.find(s);
+            if (it != stringIds.end()) return it->second;
+            SnapStr ref{static_cast<std::uint32_t>(strings.size()), static_cast<std::uint32_t>(s.size())};
+            strings += s;
+            stringIds.emplace(s, ref);
+            return ref;
+        }
+
+        template <typename T>
+        void section(SnapshotSection s, const std::vector<T>& records) {
+            align();
+            head.sections[static_cast<int>(s)] = SnapSection{out.size(), records.size(), sizeof(T), 0};
+            out.append(reinterpret_cast<const char*>(records.data()), records.size() * sizeof(T));
+        }
+
+        std::string finish(const std::array<SnapSource, static_cast<int>(SnapshotSource::count)>& sources) {
+            align();
+            head.sections[static_cast<int>(SnapshotSection::strings)] = SnapSection{out.size(), strings.size(), 1, 0};
+            out += strings;
+            for (int i = 0; i < static_cast<int>(SnapshotSource::count); i++) head.sources[i] = sources[i];
+            std::memcpy(&out[0], &head, sizeof(head));
+            return std::move(out);
+        }
+    };
+}
+
+// ===================================== JSON database <-> records ===================================== //
+
+void stampSnapshotSources(SnapshotData& data) {
+    for (int i = 0; i < static_cast<int>(SnapshotSource::count); i++)
+        data.sources[i] = sourceStamp(snapshotSourceFiles[i]);
+}
+
+// --- Stamped before reading: a file written while it is being read leaves the snapshot stale :
+SnapshotData loadJsonDatabase() {
+    SnapshotData data;
+    stampSnapshotSources(data);
+    data.aircrafts    = loadAircraftRecords(snapshotSourceFiles[static_cast<int>(SnapshotSource::aircraft)]);
+    data.crew         = loadCrewRecords(snapshotSourceFiles[static_cast<int>(SnapshotSource::crew)]);
+    data.users        = loadUserRecords(snapshotSourceFiles[static_cast<int>(SnapshotSource::users)]);
+    data.flights      = loadFlightRecords(snapshotSourceFiles[static_cast<int>(SnapshotSource::flights)]);
+    data.reservations = loadReservationRecords(snapshotSourceFiles[static_cast<int>(SnapshotSource::reservations)]);
+    return data;
+}
+
+namespace {
+    template <typename Record>
+    void saveJsonTable(SnapshotSource source, const std::vector<Record>& records) {
+        nlohmann::json jArray = nlohmann::json::array();
+        for (const auto& r : records) jArray.push_back(toJson(r));
+        writeFileAtomic(snapshotSourceFiles[static_cast<int>(source)], jArray.dump(4));
+    }
+}
+
+void saveJsonDatabase(const SnapshotData& data) {
+    saveJsonTable(SnapshotSource::aircraft, data.aircrafts);
+    saveJsonTable(SnapshotSource::crew, data.crew);
+    saveJsonTable(SnapshotSource::users, data.users);
+    saveJsonTable(SnapshotSource::flights, data.flights);
+    saveJsonTable(SnapshotSource::reservations, data.reservations);
+}
+
+// ===================================== Writing a snapshot ===================================== //
+
+void writeSnapshot(const std::string& path, const SnapshotData& data) {
+    SnapshotWriter writer;
+
+    std::vector<SnapAircraft> aircrafts;
+    aircrafts.reserve(data.aircrafts.size());
+    for (const auto& r : data.aircrafts) {
+        SnapAircraft a{};
+        a.model = writer.str(r.model);
+        a.capacity = r.capacity;
+        a.available = r.available ? 1 : 0;
+        a.lastMaintenance = toSeconds(r.lastMaintenance);
+        a.nextMaintenance = toSeconds(r.nextMaintenance);
+        aircrafts.push_back(a);
+    }
+
+    std::vector<SnapCrew> crew;
+    crew.reserve(data.crew.size());
+    for (const auto& r : data.crew) {
+        SnapCrew c{};
+        c.crewID = r.crewID;
+        c.name = writer.str(r.name);
+        c.role = writer.str(r.role);
+        c.totalFlightHours = r.totalFlightHours;
+        crew.push_back(c);
+    }
+
+    std::vector<SnapUser> users;
+    users.reserve(data.users.size());
+    for (const auto& r : data.users) {
+        SnapUser u{};
+        u.id = r.id;
+        u.role = static_cast<std::uint8_t>(r.role);
+        u.name = writer.str(r.name);
+        u.email = writer.str(r.email);
+        u.password = writer.str(r.password);
+        users.push_back(u);
+    }
+
+    std::vector<SnapFlight> flights;
+    std::vector<std::int32_t> flightCrew;
+    flights.reserve(data.flights.size());
+    for (const auto& r : data.flights) {
+        SnapFlight f{};
+        f.flightNumber = r.flightNumber;
+        f.status = static_cast<std::uint8_t>(r.status);
+        f.origin = writer.str(r.origin);
+        f.destination = writer.str(r.destination);
+        f.aircraftModel = writer.str(r.aircraftModel);
+        f.departureTime = toSeconds(r.departureTime);
+        f.arrivalTime = toSeconds(r.arrivalTime);
+        f.crewFirst = static_cast<std::uint32_t>(flightCrew.size());
+        f.crewCount = static_cast<std::uint32_t>(r.crewIDs.size());
+        flightCrew.insert(flightCrew.end(), r.crewIDs.begin(), r.crewIDs.end());
+        flights.push_back(f);
+    }
+
+    std::vector<SnapReservation> reservations;
+    reservations.reserve(data.reservations.size());
+    for (const auto& r : data.reservations) {
+        SnapReservation res{};
+        res.reservationId = r.reservationId;
+        res.passengerId = r.passengerId;
+        res.flightNumber = r.flightNumber;
+        res.seatNumber = r.seatNumber;
+        res.amount = r.amount;
+        res.checkIn = writer.str(r.checkIn);
+        res.method = writer.str(r.method);
+        res.details = writer.str(r.details);
+        reservations.push_back(res);
+    }
+
+    writer.section(SnapshotSection::aircraft, aircrafts);
+    writer.section(SnapshotSection::crew, crew);
+    writer.section(SnapshotSection::users, users);
+    writer.section(SnapshotSection::flights, flights);
+    writer.section(SnapshotSection::flightCrew, flightCrew);
+    writer.section(SnapshotSection::reservations, reservations);
+    writeFileAtomic(path, writer.finish(data.sources));
+}
+
+// ===================================== SnapshotView Class ===================================== //
+
+SnapshotView::SnapshotView(const std::string& path) {
+#if defined(_WIN32)
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                              FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) throw std::runtime_error("Could not open snapshot " + path);
+    LARGE_INTEGER fileSize;
+    GetFileSizeEx(file, &fileSize);
+    HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (!mapping) {
+        CloseHandle(file);
+        throw std::runtime_error("Could not map snapshot " + path);
+    }
+    fileHandle = file;
+    mappingHandle = mapping;
+    length = static_cast<std::size_t>(fileSize.QuadPart);
+    base = static_cast<const char*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+#else
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) throw std::runtime_error("Could not open snapshot " + path);
+    struct stat st{};
+    fstat(fd, &st);
+    length = static_cast<std::size_t>(st.st_size);
+    void* mapped = length ? mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0) : MAP_FAILED;
+    ::close(fd);    // the mapping keeps the file alive
+    base = (mapped == MAP_FAILED) ? nullptr : static_cast<const char*>(mapped);
+#endif
+    if (!base) {
+        unmap();
+        throw std::runtime_error("Could not map snapshot " + path);
+    }
+    try {
+        validate();
+    } catch (...) {
+        unmap();
+        throw;
+    }
+}
+
+SnapshotView::~SnapshotView() {
+    unmap();
+}
+
+void SnapshotView::unmap() {
+#if defined(_WIN32)
+    if (base) UnmapViewOfFile(base);
+    if (mappingHandle) CloseHandle(mappingHandle);
+    if (fileHandle) CloseHandle(fileHandle);
+    mappingHandle = fileHandle = nullptr;
+#else
+    if (base) munmap(const_cast<char*>(base), length);
+#endif
+    base = nullptr;
+}
+
+// --- Reject truncated files and files written with another layout :
+void SnapshotView::validate() const {
+    if (length < sizeof(SnapshotHeader) || std::memcmp(header().magic, snapshotMagic, sizeof(snapshotMagic)) != 0)
+        throw std::runtime_error("Not an airline snapshot file");
+    if (header().version != snapshotVersion || header().headerSize != sizeof(SnapshotHeader))
+        throw std::runtime_error("Unsupported snapshot version " + std::to_string(header().version));
+
+    const std::uint32_t recordSizes[] = {sizeof(SnapAircraft), sizeof(SnapCrew), sizeof(SnapUser), sizeof(SnapFlight),
+                                         sizeof(std::int32_t), sizeof(SnapReservation), 1};
+    for (int i = 0; i < static_cast<int>(SnapshotSection::count); i++) {
+        const SnapSection& s = header().sections[i];
+        if (s.recordSize != recordSizes[i] || s.offset > length || s.count > (length - s.offset) / s.recordSize)
+            throw std::runtime_error("Corrupt snapshot section " + std::to_string(i));
+    }
+
+    const SnapFlight* flights = section<SnapFlight>(SnapshotSection::flights);
+    for (std::size_t i = 0; i < count(SnapshotSection::flights); i++) {
+        if (std::uint64_t(flights[i].crewFirst) + flights[i].crewCount > count(SnapshotSection::flightCrew))
+            throw std::runtime_error("Corrupt snapshot crew range");
+    }
+}
+
+std::string_view SnapshotView::str(const SnapStr& s) const {
+    const SnapSection& table = header().sections[static_cast<int>(SnapshotSection::strings)];
+    if (std::uint64_t(s.offset) + s.length > table.count)
+        throw std::runtime_error("Corrupt snapshot string reference");
+    return std::string_view(base + table.offset + s.offset, s.length);
+}
+
+bool SnapshotView::isFresh() const {
+    for (int i = 0; i < static_cast<int>(SnapshotSource::count); i++) {
+        if (!sameStamp(sourceStamp(snapshotSourceFiles[i]), header().sources[i])) return false;
+    }
+    return true;
+}
+
+// ---------------------------- Bulk loading into records ---------------------------- //
+std::vector<AircraftRecord> SnapshotView::aircraftRecords() const {
+    std::vector<AircraftRecord> records(count(SnapshotSection::aircraft));
+    const SnapAircraft* rows = section<SnapAircraft>(SnapshotSection::aircraft);
+    for (std::size_t i = 0; i < records.size(); i++) {
+        records[i].model = std::string(str(rows[i].model));
+        records[i].capacity = rows[i].capacity;
+        records[i].available = rows[i].available != 0;
+        records[i].lastMaintenance = fromSeconds(rows[i].lastMaintenance);
+        records[i].nextMaintenance = fromSeconds(rows[i].nextMaintenance);
+    }
+    return records;
+}
+
+std::vector<CrewRecord> SnapshotView::crewRecords() const {
+    std::vector<CrewRecord> records(count(SnapshotSection::crew));
+    const SnapCrew* rows = section<SnapCrew>(SnapshotSection::crew);
+    for (std::size_t i = 0; i < records.size(); i++) {
+        records[i].crewID = rows[i].crewID;
+        records[i].name = std::string(str(rows[i].name));
+        records[i].role = std::string(str(rows[i].role));
+        records[i].totalFlightHours = rows[i].totalFlightHours;
+    }
+    return records;
+}
+
+std::vector<UserRecord> SnapshotView::userRecords() const {
+    std::vector<UserRecord> records(count(SnapshotSection::users));
+    const SnapUser* rows = section<SnapUser>(SnapshotSection::users);
+    for (std::size_t i = 0; i < records.size(); i++) {
+        records[i].id = rows[i].id;
+        records[i].role = static_cast<Role>(rows[i].role);
+        records[i].name = std::string(str(rows[i].name));
+        records[i].email = std::string(str(rows[i].email));
+        records[i].password = std::string(str(rows[i].password));
+    }
+    return records;
+}
+
+std::vector<FlightRecord> SnapshotView::flightRecords() const {
+    std::vector<FlightRecord> records(count(SnapshotSection::flights));
+    const SnapFlight* rows = section<SnapFlight>(SnapshotSection::flights);
+    const std::int32_t* crewIds = section<std::int32_t>(SnapshotSection::flightCrew);
+    for (std::size_t i = 0; i < records.size(); i++) {
+        records[i].flightNumber = rows[i].flightNumber;
+        records[i].status = static_cast<FlightStatus>(rows[i].status);
+        records[i].origin = std::string(str(rows[i].origin));
+        records[i].destination = std::string(str(rows[i].destination));
+        records[i].aircraftModel = std::string(str(rows[i].aircraftModel));
+        records[i].departureTime = fromSeconds(rows[i].departureTime);
+        records[i].arrivalTime = fromSeconds(rows[i].arrivalTime);
+        records[i].crewIDs.assign(crewIds + rows[i].crewFirst, crewIds + rows[i].crewFirst + rows[i].crewCount);
+    }
+    return records;
+}
+
+std::vector<ReservationRecord> SnapshotView::reservationRecords() const {
+    std::vector<ReservationRecord> records(count(SnapshotSection::reservations));
+    const SnapReservation* rows = section<SnapReservation>(SnapshotSection::reservations);
+    for (std::size_t i = 0; i < records.size(); i++) {
+        records[i].reservationId = rows[i].reservationId;
+        records[i].passengerId = rows[i].passengerId;
+        records[i].flightNumber = rows[i].flightNumber;
+        records[i].seatNumber = rows[i].seatNumber;
+        records[i].amount = rows[i].amount;
+        records[i].checkIn = std::string(str(rows[i].checkIn));
+        records[i].method = std::string(str(rows[i].method));
+        records[i].details = std::string(str(rows[i].details));
+    }
+    return records;
+}
+
+SnapshotData SnapshotView::load() const {
+    SnapshotData data;
+    data.aircrafts = aircraftRecords();
+    data.crew = crewRecords();
+    data.users = userRecords();
+    data.flights = flightRecords();
+    data.reservations = reservationRecords();
+    for (int i = 0; i < static_cast<int>(SnapshotSource::count); i++) data.sources[i] = header().sources[i];
+    return data;
+}
+
+// ---------------------------- Startup helper ---------------------------- //
+std::unique_ptr<SnapshotView> openFreshSnapshot(const std::string& path) {
+    struct stat st{};
+    if (stat(path.c_str(), &st) != 0) return nullptr;     // no snapshot: normal JSON startup
+    try {
+        auto view = std::make_unique<SnapshotView>(path);
+        if (view->isFresh()) return view;
+        std::cout << "Snapshot " << path << " is older than the JSON files, loading JSON instead.\n";
+    } catch (const std::exception& e) {
+        std::cout << "Ignoring snapshot " << path << ": " << e.what() << "\n";
+    }
+    return nullptr;
+}
+
+bool refreshSnapshot(const std::string& path) {
+    struct stat st{};
+    if (stat(path.c_str(), &st) != 0) return false;
+    try {
+        {
+            SnapshotView view(path);                // unmapped before the file is replaced
+            if (view.isFresh()) return false;
+        }
+    } catch (const std::exception&) {
+        // unreadable: rewrite it
+    }
+    try {
+        writeSnapshot(path, loadJsonDatabase());
+        std::cout << "Snapshot " << path << " refreshed.\n";
+        return true;
+    } catch (const std::exception& e) {
+        std::cerr << "Could not refresh snapshot " << path << ": " << e.what() << "\n";
+        return false;
+    }
+}
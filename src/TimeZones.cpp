@@ -0,0 +1,120 @@
+#include "../Include/TimeZones.hpp"
+#include <unordered_map>
+
+namespace {
+    // Standard offsets as of 2025. Each airport is listed under its IATA code and its city.
+    const AirportZone zoneTable[] = {
+        {"CAI", 120, DstRule::egypt},  {"Cairo", 120, DstRule::egypt},      {"Egypt", 120, DstRule::egypt},
+        {"LXR", 120, DstRule::egypt},  {"Luxor", 120, DstRule::egypt},
+        {"DXB", 240, DstRule::none},   {"Dubai", 240, DstRule::none},
+        {"MCT", 240, DstRule::none},   {"Muscat", 240, DstRule::none},
+        {"DOH", 180, DstRule::none},   {"Doha", 180, DstRule::none},
+        {"RUH", 180, DstRule::none},   {"Riyadh", 180, DstRule::none},
+        {"JED", 180, DstRule::none},   {"Jeddah", 180, DstRule::none},
+        {"KWI", 180, DstRule::none},   {"Kuwait", 180, DstRule::none},
+        {"AMM", 180, DstRule::none},   {"Amman", 180, DstRule::none},
+        {"IST", 180, DstRule::none},   {"Istanbul", 180, DstRule::none},
+        {"NBO", 180, DstRule::none},   {"Nairobi", 180, DstRule::none},
+        {"BEY", 120, DstRule::lebanon}, {"Beirut", 120, DstRule::lebanon},
+        {"ATH", 120, DstRule::europe}, {"Athens", 120, DstRule::europe},
+        {"JNB", 120, DstRule::none},   {"Johannesburg", 120, DstRule::none},
+        {"LHR", 0, DstRule::europe},   {"London", 0, DstRule::europe},      {"England", 0, DstRule::europe},
+        {"CDG", 60, DstRule::europe},  {"Paris", 60, DstRule::europe},
+        {"FRA", 60, DstRule::europe},  {"Frankfurt", 60, DstRule::europe},
+        {"AMS", 60, DstRule::europe},  {"Amsterdam", 60, DstRule::europe},
+        {"FCO", 60, DstRule::europe},  {"Rome", 60, DstRule::europe},
+        {"MAD", 60, DstRule::europe},  {"Madrid", 60, DstRule::europe},
+        {"TUN", 60, DstRule::none},    {"Tunis", 60, DstRule::none},
+        {"CMN", 60, DstRule::none},    {"Casablanca", 60, DstRule::none},
+        {"JFK", -300, DstRule::northAmerica}, {"New York", -300, DstRule::northAmerica}, {"America", -300, DstRule::northAmerica},
+        {"YYZ", -300, DstRule::northAmerica}, {"Toronto", -300, DstRule::northAmerica},
+        {"ORD", -360, DstRule::northAmerica}, {"Chicago", -360, DstRule::northAmerica},
+        {"BOM", 330, DstRule::none},   {"Mumbai", 330, DstRule::none},
+        {"DEL", 330, DstRule::none},   {"Delhi", 330, DstRule::none},
+        {"BKK", 420, DstRule::none},   {"Bangkok", 420, DstRule::none},
+        {"SIN", 480, DstRule::none},   {"Singapore", 480, DstRule::none},
+        {"NRT", 540, DstRule::none},   {"Tokyo", 540, DstRule::none},
+    };
+
+    constexpr long long secondsPerDay = 86400;
+
+    long long floorDiv(long long a, long long b) {
+        return a / b - ((a % b != 0) && ((a < 0) != (b < 0)));
+    }
+
+    // 0 = Sunday (day 0, 1970-01-01, was a Thursday)
+    int weekday(long long day) {
+        return static_cast<int>(((day % 7) + 7 + 4) % 7);
+    }
+
+    long long lastWeekdayOf(int year, int month, int lastDayOfMonth, int wanted) {
+        long long last = daysFromCivil(year, month, lastDayOfMonth);
+        return last - (weekday(last) - wanted + 7) % 7;
+    }
+
+    long long lastSundayOf(int year, int month, int lastDayOfMonth) {
+        return lastWeekdayOf(year, month, lastDayOfMonth, 0);
+    }
+
+    long long nthSundayOf(int year, int month, int n) {
+        long long first = daysFromCivil(year, month, 1);
+        return first + (7 - weekday(first)) % 7 + 7 * (n - 1);
+    }
+
+    long long epochSeconds(const timeType& tp) {
+        return std::chrono::duration_cast<std::chrono::seconds>(tp.time_since_epoch()).count();
+    }
+}
+
+// --- Hash lookup built once (thread-safe static init) :
+const AirportZone* findAirportZone(const std::string& airport) {
+    static const std::unordered_map<std::string, const AirportZone*> byName = [] {
+        std::unordered_map<std::string, const AirportZone*> map;
+        for (const auto& zone : zoneTable) map.emplace(zone.name, &zone);
+        return map;
+    }();
+    auto it = byName.find(airport);
+    return it == byName.end() ? nullptr : it->second;
+}
+
+int utcOffsetMinutesAt(const AirportZone* zone, const timeType& tp) {
+    if (!zone) return 0;
+    const long long seconds = epochSeconds(tp);
+    const int standard = zone->utcOffsetMinutes;
+    if (zone->dst == DstRule::none) return standard;
+
+    int year, month, day;
+    civilFromDays(floorDiv(seconds + standard * 60, secondsPerDay), year, month, day);
+    long long start, end;       // UTC seconds, daylight time is [start, end)
+    if (zone->dst == DstRule::europe) {
+        start = lastSundayOf(year, 3, 31) * secondsPerDay + 3600;
+        end = lastSundayOf(year, 10, 31) * secondsPerDay + 3600;
+    } else if (zone->dst == DstRule::egypt) {
+        if (year < 2023) return standard;       // no daylight time 2015-2022
+        start = lastWeekdayOf(year, 4, 30, 5) * secondsPerDay - standard * 60;
+        end = (lastWeekdayOf(year, 10, 31, 4) + 1) * secondsPerDay - (standard + 60) * 60;
+    } else if (zone->dst == DstRule::lebanon) {
+        start = lastSundayOf(year, 3, 31) * secondsPerDay - standard * 60;
+        end = lastSundayOf(year, 10, 31) * secondsPerDay - (standard + 60) * 60;
+    } else {
+        start = nthSundayOf(year, 3, 2) * secondsPerDay + 2 * 3600 - standard * 60;
+        end = nthSundayOf(year, 11, 1) * secondsPerDay + 2 * 3600 - (standard + 60) * 60;
+    }
+    return (seconds >= start && seconds < end) ? standard + 60 : standard;
+}
+
+int localDayAt(const std::string& airport, const timeType& tp) {
+    const AirportZone* zone = findAirportZone(airport);
+    return static_cast<int>(floorDiv(epochSeconds(tp) + utcOffsetMinutesAt(zone, tp) * 60LL, secondsPerDay));
+}
+
+// --- Offset at the UTC midnight first, then at the instant that gives; a day starting inside a
+//     spring-forward gap starts when the clocks resume :
+timeType localMidnightAt(const std::string& airport, int day) {
+    const AirportZone* zone = findAirportZone(airport);
+    auto at = [](long long seconds) { return timeType(std::chrono::duration_cast<timeType::duration>(std::chrono::seconds(seconds))); };
+    const long long midnight = day * secondsPerDay;
+    long long guess = midnight - utcOffsetMinutesAt(zone, at(midnight)) * 60LL;
+    guess = midnight - utcOffsetMinutesAt(zone, at(guess)) * 60LL;
+    return at(guess);
+}
@@ -1,33 +1,66 @@
 #include "../Include/UserSystem.hpp"
+#include "../Include/Snapshot.hpp"
+#include "../Include/RecordStream.hpp"
+#include <algorithm>
 
 // ================================= UserSystem Class Methods ================================= //
 
-// -------- No argument constructor to load users from JSON file --------- //
-
-UserSystem::UserSystem(){
-    std::ifstream Usersfile("database/Users.json");
-    if (!Usersfile.is_open()) 
-        throw std::runtime_error("Could not open users.json");
-    nlohmann::json j;
-    Usersfile >> j; // Read the full JSON array from file
+// -------- Constructor: build users from the startup tables or from JSON --------- //
+
+UserSystem::UserSystem(const SnapshotData* tables) : usersJournal("database/Users.json", "id") {
+    // Rows come already parsed at startup (see Bootstrap), otherwise streamed from Users.json
+    if (tables) {
+        const std::vector<UserRecord>& records = tables->users;
+        users.reserve(records.size());
+        usersById.reserve(records.size());
+        usersByEmail.reserve(records.size());
+        for (const auto& r : records) {
+            insertUser(userFromRecord(r));
+        }
+    } else {
+        streamUserRecords("database/Users.json", [this](UserRecord&& r) {
+            insertUser(userFromRecord(r));
+        }, consoleProgress("users"));
+    }
 
-    // Iterate over each user entry in the JSON array
-    for (const auto& item : j) {
-        int id              = item["id"];
-        std::string name    = item["name"]; 
-        std::string email   = item["email"];
-        std::string pass    = item["password"];
-        Role role           = stringToRole(item["role"]);  
-        std::shared_ptr<User> user = nullptr;
+    // Re-apply changes journaled since the last checkpoint
+    usersJournal.replay([this](JournalOp op, const nlohmann::json& key, const nlohmann::json& row) {
+        if (op == JournalOp::put) {
+            eraseUser(key);
+            insertUser(userFromRecord(userRecordFromJson(row)));
+        } else if (op == JournalOp::remove) {
+            eraseUser(key);
+        }
+    });
+}
 
-        if(role == Role::admin) user = std::make_shared<Administrator>(name, email, pass, id); 
-        else if(role == Role::agent) user = std::make_shared<BookingAgent>(name, email, pass, id);
-        else if(role == Role::passenger) user = std::make_shared<Passenger>(name, email, pass, id);
+// ------------- Build a user from one Users.json row ------------- //
+std::shared_ptr<User> UserSystem::userFromRecord(const UserRecord& r) const {
+    if(r.role == Role::admin) return std::make_shared<Administrator>(r.name, r.email, r.password, r.id); 
+    else if(r.role == Role::agent) return std::make_shared<BookingAgent>(r.name, r.email, r.password, r.id);
+    else if(r.role == Role::passenger) return std::make_shared<Passenger>(r.name, r.email, r.password, r.id);
 
-        else throw std::runtime_error("Invalid role in JSON" + roleToString(role));
-        users.push_back(user);
+    throw std::runtime_error("Invalid role in JSON" + roleToString(r.role));
+}
 
+// ------------- Add / remove a user in memory and in the id and email indexes ------------- //
+void UserSystem::insertUser(const std::shared_ptr<User>& user){
+    if (!usersById.insert(user->getId(), user))
+        throw std::runtime_error("Duplicate user id: " + std::to_string(user->getId()));
+    if (!usersByEmail.insert(user->getEmail(), user)) {
+        usersById.erase(user->getId());
+        throw std::runtime_error("Duplicate user email: " + user->getEmail());
     }
+    users.push_back(user);
+}
+
+bool UserSystem::eraseUser(int userId){
+    auto user = usersById.find(userId);
+    if (!user) return false;
+    usersByEmail.erase(user->getEmail());
+    usersById.erase(userId);
+    users.erase(std::remove(users.begin(), users.end(), user), users.end());
+    return true;
 }
 
 // --------------------------- Display all users ------------------------// 
@@ -42,153 +75,133 @@ void UserSystem::displayUsers() const{
 
 // ------------------------------- Current user ------------------------------- //
 std::shared_ptr <User> UserSystem::getCurrentUser(const std::string& email){
-    for(const auto& user: users){
-        if(user->getEmail() == email)          
-         return user;
-    }
-    return nullptr; // Return nullptr if no matching user is found
+    return usersByEmail.find(email); // nullptr if no matching user is found
 }
 
 // --------------------------- Check email is unique ----------------------- // 
 bool UserSystem::isEmailUnique(const std::string& email) const{
-    for(const auto& user: users){
-        if(user->getEmail() == email) return false;
-    }
-    return true;
+    return !usersByEmail.contains(email);
 }
 // --------------------------- Create a new user --------------------------- //
 void UserSystem::addUser(){
-    int newId = users.empty() ? 1 : users.back()->getId() + 1;
-    std::string name, email, password;
-    Role role;
+    UserRecord user;
     while(true){
-        std::cout << "Enter name: ";            std::cin >> name;
-        std::cout << "Enter email: ";           std::cin >> email;
-        if(!isEmailUnique(email)){
+        std::cout << "Enter name: ";            std::cin >> user.name;
+        std::cout << "Enter email: ";           std::cin >> user.email;
+        if(!isEmailUnique(user.email)){
             std::cout << "Email already exists. Please use a different email.";
             continue;
         }
-    std::cout << "Enter password: ";        std::cin >> password;
+    std::cout << "Enter password: ";        std::cin >> user.password;
     std::cout << "Enter role (1) admin/ (2) agent/ (3) passenger): ";
     int roleChoice;                          std::cin >> roleChoice;
-    role = static_cast<Role>(roleChoice - 1);
+    user.role = (roleChoice == 1) ? Role::admin : (roleChoice == 2) ? Role::agent
+              : (roleChoice == 3) ? Role::passenger : Role::none;
     break;
     }
 
-    if(role == Role::admin)
-        inputUser = std::make_shared<Administrator>(name, email, password, newId);
-    else if(role == Role::agent)
-        inputUser = std::make_shared<BookingAgent>(name, email, password, newId);
-    else if(role == Role::passenger)
-        inputUser = std::make_shared<Passenger>(name, email, password, newId);
-    else throw std::runtime_error("Invalid role selected.");
-
-    users.push_back(inputUser);
-
-    // Save to JSON file after adding
-    nlohmann::json jArray = nlohmann::json::array();
-
-   for (auto& user : users) {
-    // parse the JSON string returned by getUserJson into a json object
-        jArray.push_back(user->getUserJson());
-    }
-
-    std::ofstream outFile("database/Users.json");
-    if(!outFile.is_open())
-        throw std::runtime_error("Could not open Flights.json for writing");
-    outFile << jArray.dump(4); 
-    std::cout << "User added successfully.\n";
+    OpResult result = addUser(user);
+    std::cout << (result.ok ? "User added successfully.\n" : result.error + "\n");
 }
 
 // --------------------------------------- Remove user --------------------------------------- //
 void UserSystem::removeUser() {
     std::cout << "Enter User ID to remove: ";
     int userId; std::cin>>userId;
-    auto it = std::remove_if(users.begin(), users.end(),
-        [userId](const std::shared_ptr<User>& user) { return user->getId() == userId;
-        });
-
-    if (it != users.end()) {
-        users.erase(it, users.end());
 
-        // Save to JSON file after removing
-        nlohmann::json jArray = nlohmann::json::array();
-        for (const auto& user : users) {
-            jArray.push_back(user->getUserJson());
-        }
-
-        std::ofstream outFile("database/Users.json");
-        outFile << jArray.dump(4);
-    } 
-    else std::cout << "User ID not found.";
+    if (!removeUser(userId).ok) std::cout << "User ID not found.";
 }
 
 // --------------------------------------- Update user --------------------------------------- //
 void UserSystem::updateUser() {
     std::cout << "Enter User ID: ";
     int userId; std::cin>>userId;
-    std::string newName, newEmail, newPassword;
+    UserUpdate update;
     std::cout << "Enter new name (or press Enter to skip): ";
     std::cin.ignore(); 
-    std::getline(std::cin, newName);
+    std::getline(std::cin, update.name);
     std::cout << "Enter new email (or press Enter to skip): ";
-    std::getline(std::cin, newEmail);
+    std::getline(std::cin, update.email);
     std::cout << "Enter new password (or press Enter to skip): ";
-    std::getline(std::cin, newPassword);
-
-    for (auto& user : users) {
-        if (user->getId() == userId) {
-            if (!newName.empty()) user->userName = newName;
-            if (!newEmail.empty()) {
-                if (!isEmailUnique(newEmail)) {
-                    throw std::runtime_error("Email already exists. Please use a different email.");
-                }
-                user->email = newEmail;
-            }
-            if (!newPassword.empty()) user->password = newPassword;
-
-            // Save to JSON file after updating
-            nlohmann::json jArray = nlohmann::json::array();
-            for (const auto& u : users) {
-                jArray.push_back(u->getUserJson());
-            }
-
-            std::ofstream outFile("database/Users.json");
-            outFile << jArray.dump(4);
-            std::cout << "User updated successfully.\n";
-            return;
-        }
-    }
-    throw std::runtime_error("User ID not found.");
+    std::getline(std::cin, update.password);
+
+    OpResult result = updateUser(userId, update);
+    std::cout << (result.ok ? "User updated successfully.\n" : result.error + "\n");
 }
 
 // ------------- check login Info ---------------------- //
 bool UserSystem::login(const std::string& inputemail, const std::string& password) {
-    for (const auto& user : users) {
-        if (user->getEmail() == inputemail && user->checkPassword(password)) {
-            Role r = user->getRole();
+    if (auto user = authenticate(inputemail, password)) {
+        Role r = user->getRole();
         if (r == Role::admin)
             inputUser = std::make_shared<Administrator>(user->getUserName(), user->getEmail(), user->getpassword(), user->getId());
         else if (r == Role::agent)
             inputUser = std::make_shared<BookingAgent>(user->getUserName(), user->getEmail(), user->getpassword(), user->getId());
         else if (r == Role::passenger)
             inputUser = std::make_shared<Passenger>(user->getUserName(), user->getEmail(), user->getpassword(), user->getId());
-    std::cout << "Login successful as " << roleToString(r) << "!\n";
-    return true;
+        std::cout << "Login successful as " << roleToString(r) << "!\n";
+        return true;
+    }
+    std::cout << "Invalid email or password.\n";
+    return false;
 }
-        }
-        std::cout << "Invalid email or password.\n";
-        return false;
+
+// ---------------------------- Headless API ---------------------------- //
+std::shared_ptr<User> UserSystem::authenticate(const std::string& email, const std::string& password) const {
+    auto user = usersByEmail.find(email);
+    return (user && user->checkPassword(password)) ? user : nullptr;
+}
+
+OpResult UserSystem::addUser(const UserRecord& user) {
+    if (user.role != Role::admin && user.role != Role::agent && user.role != Role::passenger)
+        return OpResult::failure("Invalid role selected.");
+    if (!isEmailUnique(user.email))
+        return OpResult::failure("Email already exists. Please use a different email.");
+
+    UserRecord row = user;
+    if (row.id == 0) {
+        row.id = users.empty() ? 1 : users.back()->getId() + 1;
+        while (usersById.contains(row.id)) ++row.id;     // ids loaded from file may be out of order
+    } else if (usersById.contains(row.id)) {
+        return OpResult::failure("User ID already exists.");
+    }
+
+    inputUser = userFromRecord(row);
+    insertUser(inputUser);
+
+    // Journal the new user row
+    usersJournal.put(inputUser->getUserJson());
+    return OpResult::success(row.id);
+}
+
+OpResult UserSystem::removeUser(int userId) {
+    if (!eraseUser(userId)) return OpResult::failure("User ID not found.");
+    usersJournal.remove(userId);
+    return OpResult::success();
+}
+
+OpResult UserSystem::updateUser(int userId, const UserUpdate& update) {
+    auto user = usersById.find(userId);
+    if (!user) return OpResult::failure("User ID not found.");
+
+    if (!update.email.empty() && update.email != user->email) {
+        if (!isEmailUnique(update.email))
+            return OpResult::failure("Email already exists. Please use a different email.");
+        usersByEmail.rekey(user->email, update.email);
+        user->email = update.email;
     }
+    if (!update.name.empty()) user->userName = update.name;
+    if (!update.password.empty()) user->password = update.password;
+
+    // Journal the updated user row
+    usersJournal.put(user->getUserJson());
+    return OpResult::success();
+}
 
 // ----------------------- Get passenger by id -------------------------- //
 
 std::shared_ptr<Passenger> UserSystem::getPassengerById(int id) {
-    for (const auto& user : users) {
-        if (user->getId() == id) {
-            return std::dynamic_pointer_cast<Passenger>(user);
-        }
-    }
-    return nullptr; // No matching passenger found
+    // nullptr if no user has this id or the user is not a passenger
+    return std::dynamic_pointer_cast<Passenger>(usersById.find(id));
 }
 
@@ -1,10 +1,26 @@
 #include "User.hpp"
 #include "UserSystem.hpp"
 #include "AirlineSystem.hpp"
+#include <cstring>
+#include <stdexcept>
+#include <string>
 
 
-int main(){
+// Usage: AirlineReservationSystem                           -> console menus
+//        AirlineReservationSystem --serve [port] [workers]  -> booking server (see Server.hpp)
+int main(int argc, char** argv){
    AirlineSystem airlineSystem;
+   if (argc > 1 && std::strcmp(argv[1], "--serve") == 0) {
+      try {
+         int port = argc > 2 ? std::stoi(argv[2]) : 7070;
+         int workers = argc > 3 ? std::stoi(argv[3]) : 4;
+         airlineSystem.serve(port, workers);
+      } catch (const std::exception& e) {
+         std::cerr << "Serve failed: " << e.what() << "\n";
+         return 1;
+      }
+      return 0;
+   }
    airlineSystem.userLoop();
 
 }
@@ -0,0 +1,105 @@
+// Boarding pass test : renders passes in each format and checks the exact text layout, that every
+// JSON line parses back to the pass (awkward names included), and the printable box geometry.
+// Build & run with:  make test
+#include "../Include/BoardingPass.hpp"
+#include "../Include/Flight.hpp"
+#include <cstdio>
+#include <sstream>
+
+int main() {
+    int failures = 0;
+    auto check = [&](bool ok, const std::string& what) {
+        if (!ok) {
+            if (failures < 20) std::printf("FAIL: %s\n", what.c_str());
+            failures++;
+        }
+    };
+
+    const timeType departure = parseDate("2030-05-17 08:45");
+    const std::vector<std::string> names = {"Ahmed Ali", "Quote \"Q\" Back\\slash", "Tab\tNew\nLine",
+                                            "A passenger name far too long for the printable box"};
+
+    // ---------------------------- text ---------------------------- //
+    {
+        BoardingPassRenderer renderer(PassFormat::text);
+        renderer.setFlight(1000, "CAI", "DXB", departure);
+        renderer.add("Ahmed Ali", 7, 12);
+        check(renderer.output() ==
+              "\n--- Boarding Pass ---\nPassenger: Ahmed Ali\nFlight Number: 1000\nFrom: CAI\nTo: DXB\nSeat: 7\n"
+              "Boarding Time: 2030-05-17 08:45\n---------------------\n", "text layout");
+        renderer.add("Second", 8, 13);
+        check(renderer.size() == 2, "text pass count");
+        renderer.clear();
+        check(renderer.size() == 0 && renderer.output().empty(), "clear");
+    }
+
+    // ---------------------------- json ---------------------------- //
+    {
+        BoardingPassRenderer renderer(PassFormat::json);
+        renderer.setFlight(1000, "CAI", "New \"York\"", departure);
+        for (std::size_t i = 0; i < names.size(); i++) renderer.add(names[i], 10 + static_cast<int>(i), 100 + static_cast<int>(i));
+        std::istringstream lines(renderer.output());
+        std::string line;
+        std::size_t i = 0;
+        for (; std::getline(lines, line); i++) {
+            try {
+                const nlohmann::json pass = nlohmann::json::parse(line);
+                check(i < names.size() && pass.at("passenger") == names[i] && pass.at("reservationId") == 100 + static_cast<int>(i)
+                      && pass.at("seat") == 10 + static_cast<int>(i) && pass.at("flightNumber") == 1000
+                      && pass.at("origin") == "CAI" && pass.at("destination") == "New \"York\""
+                      && pass.at("boardingTime") == "2030-05-17 08:45", "json pass " + std::to_string(i));
+            } catch (const std::exception& e) {
+                check(false, "json line " + std::to_string(i) + " does not parse: " + e.what());
+            }
+        }
+        check(i == names.size(), "one json line per pass");
+    }
+
+    // ---------------------------- printable ---------------------------- //
+    {
+        BoardingPassRenderer renderer(PassFormat::printable);
+        renderer.setFlight(1000, "CAI", "DXB", departure);
+        for (std::size_t i = 0; i < names.size(); i++) renderer.add(names[i], 7, 12);
+        const std::string& text = renderer.output();
+
+        std::size_t pages = 1;
+        std::istringstream lines(text);
+        std::string line;
+        while (std::getline(lines, line)) {
+            if (!line.empty() && line[0] == '\f') {
+                pages++;
+                line.erase(0, 1);
+            }
+            check(line.size() == 40 && (line[0] == '|' || line[0] == '+') && line[0] == line[39],
+                  "printable line is a 40-column box row: [" + line + "]");
+        }
+        check(pages == names.size(), "passes separated by form feeds");
+        check(text.find("| BOARDING PASS") != std::string::npos && text.find("*R12-F1000-S7*") != std::string::npos,
+              "printable header and barcode payload");
+        check(text.find("| Passenger  A passenger name far too  |\n") != std::string::npos, "long name cut to the box");
+    }
+
+    // ---------------------------- From a manifest ---------------------------- //
+    {
+        auto aircraft = std::make_shared<Aircraft>("A320", 180);
+        Flight flight(1000, "CAI", "DXB", FlightStatus::scheduled, aircraft, departure, departure + std::chrono::hours(3));
+        std::vector<ManifestEntry> manifest(4);
+        for (int i = 0; i < 4; i++) manifest[i] = {i + 1, 20 + i, 30 + i, "Passenger " + std::to_string(i), i % 2 == 0};
+        for (PassFormat format : {PassFormat::text, PassFormat::json, PassFormat::printable}) {
+            BoardingPassRenderer renderer(format);
+            check(renderer.renderManifest(flight, manifest) == 2, std::string(passFormatName(format)) + ": checked-in passes only");
+            check(renderer.renderManifest(flight, manifest, false) == 4 && renderer.size() == 6,
+                  std::string(passFormatName(format)) + ": every pass, appended");
+            check(renderer.output().find("Passenger 1") != std::string::npos, std::string(passFormatName(format)) + ": names");
+            std::ostringstream written;
+            renderer.writeTo(written);
+            check(written.str() == renderer.output(), std::string(passFormatName(format)) + ": writeTo");
+        }
+    }
+
+    check(std::string(passFormatExtension(PassFormat::text)) == "txt" && std::string(passFormatExtension(PassFormat::json)) == "jsonl"
+          && std::string(passFormatExtension(PassFormat::printable)) == "prn", "file extensions");
+
+    std::printf("BoardingPassTest: %s\n", failures == 0 ? "passed" : "FAILED");
+    return failures == 0 ? 0 : 1;
+}
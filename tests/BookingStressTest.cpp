@@ -0,0 +1,152 @@
+// Concurrent booking stress test : many agent threads call ReservationSystem::book() at once.
+// Checks that no seat or reservation id is ever handed out twice and that the seat maps agree
+// with what was sold; prints throughput per thread count. Exit code 0 = passed.
+// Build & run with:  make test         (optional argument: bookings per round, default 8000)
+#include "../Include/Reservation.hpp"
+#include "../Include/Flight.hpp"
+#include "../Include/UserSystem.hpp"
+#include "../Include/Persistence.hpp"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <random>
+#include <set>
+#include <sstream>
+#include <thread>
+
+namespace fs = std::filesystem;
+using benchClock = std::chrono::steady_clock;
+
+const int flightCount = 200;
+const int passengerCount = 1000;
+const int capacity = 180;
+
+template <typename Record>
+void writeTable(const std::string& path, const std::vector<Record>& records) {
+    nlohmann::json jArray = nlohmann::json::array();
+    for (const auto& r : records) jArray.push_back(toJson(r));
+    writeFileAtomic(path, jArray.dump(4));
+}
+
+// --- Fresh database in `dir` : one aircraft model, flightCount flights, passengerCount passengers
+void makeDatabase(const fs::path& dir) {
+    fs::remove_all(dir);
+    fs::create_directories(dir / "Database");
+    if (!fs::exists(dir / "database")) fs::create_directory_symlink("Database", dir / "database");
+
+    auto now = std::chrono::system_clock::now();
+    auto days = [](int n) { return std::chrono::hours(24 * n); };
+
+    AircraftRecord aircraft;
+    aircraft.model = "A320";
+    aircraft.capacity = capacity;
+    aircraft.lastMaintenance = now - days(30);
+    aircraft.nextMaintenance = now + days(365);
+
+    std::vector<UserRecord> users;
+    for (int i = 1; i <= passengerCount; i++) {
+        users.push_back({i, "Passenger " + std::to_string(i), "p" + std::to_string(i) + "@bench", "pw", Role::passenger});
+    }
+
+    std::vector<FlightRecord> flights;
+    for (int i = 0; i < flightCount; i++) {
+        FlightRecord f;
+        f.flightNumber = 1000 + i;
+        f.origin = "CAI";
+        f.destination = "DXB";
+        f.aircraftModel = aircraft.model;
+        f.departureTime = now + days(30 + i % 7);
+        f.arrivalTime = f.departureTime + std::chrono::hours(3);
+        flights.push_back(f);
+    }
+
+    writeTable((dir / "Database/Aircrafts.json").string(), std::vector<AircraftRecord>{aircraft});
+    writeTable((dir / "Database/Crew.json").string(), std::vector<CrewRecord>{});
+    writeTable((dir / "Database/Users.json").string(), users);
+    writeTable((dir / "Database/Flights.json").string(), flights);
+    writeTable((dir / "Database/Reservations.json").string(), std::vector<ReservationRecord>{});
+}
+
+struct Claim { int flight; int seat; int reservationId; };
+
+// --- One round: `threads` agents share `bookings` random requests (specific seats, so they collide)
+bool runRound(const fs::path& dir, int threads, int bookings) {
+    makeDatabase(dir);
+    const fs::path home = fs::current_path();
+    fs::current_path(dir);
+
+    std::streambuf* out = std::cout.rdbuf();
+    std::ostringstream quiet;
+    bool ok = true;
+    {
+        AircraftsSystem aircraftSystem;
+        UserSystem userSystem;
+        FlightSystem flightSystem(aircraftSystem);
+        ReservationSystem reservationSystem(flightSystem, userSystem);
+
+        std::vector<std::vector<Claim>> claims(threads);
+        std::vector<int> rejected(threads, 0);
+        auto start = benchClock::now();
+        std::vector<std::thread> agents;
+        for (int t = 0; t < threads; t++) {
+            agents.emplace_back([&, t] {
+                std::mt19937 rng(1234 + t);
+                for (int i = t; i < bookings; i += threads) {
+                    BookingRequest request;
+                    request.passengerId = 1 + static_cast<int>(rng() % passengerCount);
+                    request.flightNumber = 1000 + static_cast<int>(rng() % flightCount);
+                    request.seatNumber = (i % 4 == 0) ? 0 : 1 + static_cast<int>(rng() % capacity);
+                    request.method = "Visa";
+                    request.details = "stress";
+                    request.amount = 100;
+                    BookingResult result = reservationSystem.book(request);
+                    if (result.ok()) claims[t].push_back({request.flightNumber, result.seatNumber, result.reservationId});
+                    else rejected[t]++;
+                }
+            });
+        }
+        for (auto& agent : agents) agent.join();
+        double seconds = std::chrono::duration<double>(benchClock::now() - start).count();
+
+        // --- Every (flight, seat) and every reservation id must be unique, and match the seat maps
+        std::set<std::pair<int, int>> seats;
+        std::set<int> ids;
+        std::vector<int> perFlight(flightCount, 0);
+        int booked = 0, refused = 0;
+        for (int t = 0; t < threads; t++) {
+            refused += rejected[t];
+            for (const Claim& c : claims[t]) {
+                booked++;
+                perFlight[c.flight - 1000]++;
+                if (!seats.insert({c.flight, c.seat}).second || !ids.insert(c.reservationId).second) ok = false;
+            }
+        }
+        for (int f = 0; f < flightCount; f++) {
+            const SeatMap& map = flightSystem.getFlightByNumber(1000 + f)->getSeatMap();
+            if (capacity - map.seatsCount() != perFlight[f]) ok = false;
+        }
+
+        std::printf("threads=%-2d booked %6d  refused %6d  %9.0f bookings/s  %s\n", threads, booked, refused,
+                    bookings / seconds, ok ? "no double booking" : "DOUBLE BOOKING DETECTED");
+        std::cout.rdbuf(quiet.rdbuf());     // silence the per-object destructor messages
+    }
+    std::cout.rdbuf(out);
+    fs::current_path(home);
+    fs::remove_all(dir);
+    return ok;
+}
+
+int main(int argc, char** argv) {
+    const int bookings = argc > 1 ? std::atoi(argv[1]) : 8000;
+    const unsigned cores = std::max(1u, std::thread::hardware_concurrency());
+    std::printf("--- Booking stress test (%d requests per round, %d flights x %d seats, %u cores) ---\n",
+                bookings, flightCount, capacity, cores);
+
+    bool ok = true;
+    for (int threads : {1, 2, 4, 8, 16}) {
+        ok = runRound("BookingStressTest.db", threads, bookings) && ok;
+    }
+    std::printf("BookingStressTest: %s\n", ok ? "passed" : "FAILED");
+    return ok ? 0 : 1;
+}
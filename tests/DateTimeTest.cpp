@@ -0,0 +1,80 @@
+// Date / time test : walks every day from 1900 to 2100 with a naive calendar and checks that
+// parseDate and formatDateTime agree with it and round-trip, then feeds malformed dates to the parser.
+// Build & run with:  make test
+#include "../Include/Aircraft.hpp"
+#include <cstdio>
+#include <random>
+#include <stdexcept>
+
+int main() {
+    int failures = 0;
+    auto check = [&](bool ok, const std::string& what) {
+        if (!ok) {
+            if (failures < 20) std::printf("FAIL: %s\n", what.c_str());
+            failures++;
+        }
+    };
+    auto seconds = [](const timeType& tp) {
+        return std::chrono::duration_cast<std::chrono::seconds>(tp.time_since_epoch()).count();
+    };
+
+    // ---------------------------- Every day, 1900 - 2100 ---------------------------- //
+    std::mt19937 rng(11);
+    const int monthDays[] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+    long long day = -25567;                 // 1900-01-01
+    check(daysFromCivil(1900, 1, 1) == day && daysFromCivil(1970, 1, 1) == 0, "daysFromCivil epoch offsets");
+    for (int year = 1900; year <= 2100; year++) {
+        const bool leap = (year % 4 == 0 && year % 100 != 0) || year % 400 == 0;
+        for (int month = 1; month <= 12; month++) {
+            const int last = monthDays[month - 1] + (month == 2 && leap);
+            for (int d = 1; d <= last; d++, day++) {
+                char date[32];
+                std::snprintf(date, sizeof date, "%04d-%02d-%02d", year, month, d);
+                const int hour = static_cast<int>(rng() % 24), minute = static_cast<int>(rng() % 60);
+                char dateTime[48];
+                std::snprintf(dateTime, sizeof dateTime, "%s %02d:%02d", date, hour, minute);
+
+                check(daysFromCivil(year, month, d) == day, std::string("daysFromCivil ") + date);
+                int y, m, dd;
+                civilFromDays(day, y, m, dd);
+                check(y == year && m == month && dd == d, std::string("civilFromDays ") + date);
+
+                const timeType midnight = parseDate(date);
+                check(seconds(midnight) == day * 86400, std::string("parseDate ") + date);
+                check(toUtcDay(midnight) == day, std::string("toUtcDay ") + date);
+                const timeType tp = parseDate(dateTime);
+                check(seconds(tp) == day * 86400 + hour * 3600 + minute * 60, std::string("parseDate ") + dateTime);
+                check(formatDateTime(tp) == dateTime, std::string("formatDateTime ") + dateTime);
+                check(formatDateTime(midnight) == std::string(date) + " 00:00", std::string("formatDateTime ") + date);
+                check(isDateOnly(date) && !isDateOnly(dateTime), std::string("isDateOnly ") + date);
+            }
+        }
+    }
+
+    // Seconds are dropped by the formatter, and the buffer overload writes the same text
+    const timeType withSeconds = parseDate("2024-02-29 23:59") + std::chrono::seconds(59);
+    char buffer[dateTimeLength + 1];
+    check(formatDateTime(withSeconds, buffer) == dateTimeLength && std::string(buffer) == "2024-02-29 23:59",
+          "buffer overload");
+    check(formatDateTime(parseDate("1969-12-31 23:59")) == "1969-12-31 23:59", "before the epoch");
+    check(seconds(parseDate("2025-10-03  \t\r")) == daysFromCivil(2025, 10, 3) * 86400LL, "trailing blanks accepted");
+
+    // ---------------------------- Malformed input ---------------------------- //
+    for (const char* bad : {"", "2025", "2025-1-01", "2025-01-1", "2025/01/01", "2025-00-10", "2025-13-01",
+                            "2025-02-29", "2024-02-30", "2025-04-31", "2025-01-00", "2025-01-01 24:00",
+                            "2025-01-01 10:60", "2025-01-01T10:00", "2025-01-01 10:0", "2025-01-01 1000",
+                            "20x5-01-01", " 2025-01-01", "2025-01-01 10:00:00", "2025-01-01 10:00 x"}) {
+        bool threw = false;
+        try {
+            parseDate(bad);
+        } catch (const std::runtime_error&) {
+            threw = true;
+        }
+        timeType unused;
+        check(threw, std::string("parseDate accepted \"") + bad + "\"");
+        check(!tryParseDate(bad, std::char_traits<char>::length(bad), unused), std::string("tryParseDate accepted \"") + bad + "\"");
+    }
+
+    std::printf("DateTimeTest: %s\n", failures == 0 ? "passed" : "FAILED");
+    return failures == 0 ? 0 : 1;
+}
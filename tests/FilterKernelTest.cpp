@@ -0,0 +1,89 @@
+// Filter kernel test : random columns and predicates (row counts off the 64-row word size, edge
+// values included) through every kernel this CPU supports; each must match a plain per-row check.
+// Build & run with:  make test
+#include "../Include/FilterKernel.hpp"
+#include <climits>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <vector>
+
+int main() {
+    int failures = 0;
+    auto check = [&](bool ok, const std::string& what) {
+        if (!ok) {
+            if (failures < 20) std::printf("FAIL: %s\n", what.c_str());
+            failures++;
+        }
+    };
+
+    std::vector<FilterIsa> isas;
+    for (FilterIsa isa : {FilterIsa::scalar, FilterIsa::sse41, FilterIsa::avx2}) {
+        if (filterIsaSupported(isa)) {
+            check(filterKernel(isa) != nullptr, std::string("kernel for supported ") + filterIsaName(isa));
+            isas.push_back(isa);
+        }
+    }
+    check(filterIsaSupported(FilterIsa::scalar) && filterIsaSupported(bestFilterIsa()), "scalar and best ISA supported");
+    std::printf("FilterKernelTest: kernels");
+    for (FilterIsa isa : isas) std::printf(" %s", filterIsaName(isa));
+    std::printf("\n");
+
+    std::mt19937 rng(19);
+    auto in = [&](int lo, int hi) { return std::uniform_int_distribution<int>(lo, hi)(rng); };
+    // Mostly ordinary values, sometimes the int32 extremes
+    auto value = [&](int lo, int hi) { return in(0, 20) == 0 ? (in(0, 1) ? INT_MIN : INT_MAX) : in(lo, hi); };
+
+    std::size_t matched = 0;
+    for (int round = 0; round < 400; round++) {
+        const std::size_t rows = static_cast<std::size_t>(round < 200 ? round : in(0, 5000));
+        std::vector<std::uint32_t> origins(rows), destinations(rows);
+        std::vector<std::int32_t> minutes(rows), days(rows), seats(rows);
+        std::vector<std::uint8_t> statuses(rows);
+        for (std::size_t r = 0; r < rows; r++) {
+            origins[r] = static_cast<std::uint32_t>(in(1, 4));
+            destinations[r] = in(0, 30) == 0 ? 0xFFFFFFFFu : static_cast<std::uint32_t>(in(1, 4));
+            minutes[r] = value(0, 1439);
+            days[r] = value(-3, 10);
+            seats[r] = value(-1, 180);
+            statuses[r] = static_cast<std::uint8_t>(in(0, 7));
+        }
+        const FilterColumns columns{origins.data(), destinations.data(), minutes.data(), days.data(), statuses.data(), seats.data()};
+
+        FilterPredicate p;
+        p.anyOrigin = in(0, 2) == 0;
+        p.anyDestination = in(0, 2) == 0;
+        p.origin = static_cast<std::uint32_t>(in(1, 4));
+        p.destination = in(0, 10) == 0 ? 0xFFFFFFFFu : static_cast<std::uint32_t>(in(1, 4));
+        // Ranges are mostly wide and well ordered so a good share of rows pass
+        p.firstDay = value(-3, 4);
+        p.lastDay = in(0, 3) == 0 ? p.firstDay : value(2, 10);
+        p.departsFrom = value(0, 700);
+        p.departsUntil = value(600, 1439);
+        p.statusMask = in(0, 1) ? 0xFF : static_cast<std::uint8_t>(in(0, 255));
+        p.minSeatsFree = value(-1, 120);
+
+        std::vector<std::uint64_t> expected((rows + 63) / 64, 0);
+        for (std::size_t r = 0; r < rows; r++) {
+            const bool pass = (p.anyOrigin || origins[r] == p.origin) && (p.anyDestination || destinations[r] == p.destination)
+                && days[r] >= p.firstDay && days[r] <= p.lastDay && minutes[r] >= p.departsFrom && minutes[r] <= p.departsUntil
+                && ((p.statusMask >> statuses[r]) & 1) && seats[r] >= p.minSeatsFree;
+            if (pass) expected[r / 64] |= 1ULL << (r % 64);
+            matched += pass;
+        }
+
+        for (FilterIsa isa : isas) {
+            std::vector<std::uint64_t> words(expected.size() + 1, 0xA5A5A5A5A5A5A5A5ULL);     // +1: guard word
+            filterKernel(isa)(columns, p, rows, words.data());
+            check(words.back() == 0xA5A5A5A5A5A5A5A5ULL, std::string(filterIsaName(isa)) + " wrote past the bitmap");
+            words.pop_back();
+            check(words == expected, std::string(filterIsaName(isa)) + " differs from the reference, round " +
+                  std::to_string(round) + " rows " + std::to_string(rows));
+        }
+    }
+
+    check(matched > 5000, "predicates matched too few rows to be a test (" + std::to_string(matched) + ")");
+
+    std::printf("FilterKernelTest: %s\n", failures == 0 ? "passed" : "FAILED");
+    return failures == 0 ? 0 : 1;
+}
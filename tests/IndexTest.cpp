@@ -0,0 +1,89 @@
+// Hash index test : random inserts, erases, rekeys and lookups on PrimaryIndex and SecondaryIndex,
+// checked against std::map / std::multiset models.
+// Build & run with:  make test
+#include "../Include/Index.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <map>
+#include <random>
+#include <set>
+#include <string>
+#include <vector>
+
+int main() {
+    int failures = 0;
+    auto check = [&](bool ok, const std::string& what) {
+        if (!ok) {
+            if (failures < 20) std::printf("FAIL: %s\n", what.c_str());
+            failures++;
+        }
+    };
+    std::mt19937 rng(7);
+    auto pick = [&](int n) { return std::uniform_int_distribution<int>(0, n - 1)(rng); };
+
+    // ---------------------------- PrimaryIndex ---------------------------- //
+    {
+        PrimaryIndex<int, std::string> index;
+        std::map<int, std::shared_ptr<std::string>> model;
+        for (int step = 0; step < 20000; step++) {
+            const int key = pick(500);
+            const int op = pick(4);
+            if (op == 0) {
+                auto value = std::make_shared<std::string>("v" + std::to_string(step));
+                const bool fresh = !model.count(key);
+                check(index.insert(key, value) == fresh, "insert " + std::to_string(key));
+                if (fresh) model[key] = value;
+            } else if (op == 1) {
+                check(index.erase(key) == (model.erase(key) > 0), "erase " + std::to_string(key));
+            } else if (op == 2) {
+                const int newKey = pick(500);
+                const bool ok = key == newKey || (model.count(key) && !model.count(newKey));    // same key: no-op
+                check(index.rekey(key, newKey) == ok, "rekey " + std::to_string(key) + " -> " + std::to_string(newKey));
+                if (ok && key != newKey) {
+                    model[newKey] = model[key];
+                    model.erase(key);
+                }
+            }
+            auto it = model.find(key);
+            check(index.find(key) == (it != model.end() ? it->second : nullptr), "find " + std::to_string(key));
+            check(index.contains(key) == (it != model.end()), "contains " + std::to_string(key));
+            check(index.size() == model.size(), "size");
+        }
+        index.clear();
+        check(index.size() == 0 && !index.find(1), "clear");
+    }
+
+    // ---------------------------- SecondaryIndex ---------------------------- //
+    {
+        SecondaryIndex<int, int> index;
+        std::multiset<std::pair<int, int>> model;
+        for (int step = 0; step < 20000; step++) {
+            const int key = pick(50);
+            const int value = pick(20);
+            if (pick(3)) {
+                index.insert(key, value);
+                model.insert({key, value});
+            } else {
+                auto it = model.find({key, value});
+                check(index.erase(key, value) == (it != model.end()), "erase " + std::to_string(key));
+                if (it != model.end()) model.erase(it);
+            }
+
+            std::vector<int> found;
+            index.forEach(key, [&](int v) { found.push_back(v); });
+            std::sort(found.begin(), found.end());
+            std::vector<int> expected;
+            for (auto it = model.lower_bound({key, 0}); it != model.end() && it->first == key; ++it)
+                expected.push_back(it->second);
+            check(found == expected, "forEach " + std::to_string(key));
+            check(index.count(key) == expected.size(), "count " + std::to_string(key));
+            check(index.size() == model.size(), "size");
+        }
+        check(!index.erase(-1, 0), "erase of a missing key");
+        index.clear();
+        check(index.size() == 0 && index.count(1) == 0, "clear");
+    }
+
+    std::printf("IndexTest: %s\n", failures == 0 ? "passed" : "FAILED");
+    return failures == 0 ? 0 : 1;
+}
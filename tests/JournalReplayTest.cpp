@@ -0,0 +1,145 @@
+// Journal replay test : changes flights, "crashes" before the journal is checkpointed or merged,
+// then reopens the database and checks that the replayed flights match what was in memory.
+// Build & run with:  make test
+#include "../Include/Flight.hpp"
+#include "../Include/Persistence.hpp"
+#include <cstdio>
+#include <filesystem>
+#include <map>
+#include <sstream>
+
+namespace fs = std::filesystem;
+
+const int flightCount = 300;
+const int crewCount = 300;
+
+template <typename Record>
+void writeTable(const std::string& path, const std::vector<Record>& records) {
+    nlohmann::json jArray = nlohmann::json::array();
+    for (const auto& r : records) jArray.push_back(toJson(r));
+    writeFileAtomic(path, jArray.dump(4));
+}
+
+// --- flightCount 2-hour flights; each crew member flies two of them, so they load at 4 of 5 hours
+void makeDatabase(const fs::path& dir) {
+    fs::remove_all(dir);
+    fs::create_directories(dir / "Database");
+    if (!fs::exists(dir / "database")) fs::create_directory_symlink("Database", dir / "database");
+
+    auto now = std::chrono::system_clock::now();
+    auto days = [](int n) { return std::chrono::hours(24 * n); };
+
+    AircraftRecord aircraft;
+    aircraft.model = "A320";
+    aircraft.capacity = 180;
+    aircraft.lastMaintenance = now - days(30);
+    aircraft.nextMaintenance = now + days(365);
+
+    std::vector<CrewRecord> crew;
+    for (int i = 1; i <= crewCount + 1; i++) crew.push_back({i, "Crew " + std::to_string(i), "Attendant", 0.0});
+
+    std::vector<FlightRecord> flights;
+    const timeType base = std::chrono::time_point_cast<std::chrono::minutes>(now) + days(30);
+    for (int i = 0; i < flightCount; i++) {
+        FlightRecord f;
+        f.flightNumber = 1000 + i;
+        f.origin = "CAI";
+        f.destination = "DXB";
+        f.aircraftModel = aircraft.model;
+        f.departureTime = base + std::chrono::hours(i % 24);
+        f.arrivalTime = f.departureTime + std::chrono::hours(2);
+        f.crewIDs = {1 + i % crewCount, 1 + (i + 1) % crewCount};
+        flights.push_back(f);
+    }
+
+    writeTable((dir / "Database/Aircrafts.json").string(), std::vector<AircraftRecord>{aircraft});
+    writeTable((dir / "Database/Crew.json").string(), crew);
+    writeTable((dir / "Database/Users.json").string(), std::vector<UserRecord>{});
+    writeTable((dir / "Database/Flights.json").string(), flights);
+    writeTable((dir / "Database/Reservations.json").string(), std::vector<ReservationRecord>{});
+}
+
+// --- What the test compares before the crash and after reopening
+struct State {
+    std::map<int, FlightStatus> statuses;
+    std::map<int, std::size_t> crewPerFlight;
+    std::map<int, double> crewHours;
+};
+
+State stateOf(const FlightSystem& flights) {
+    State state;
+    for (const auto& flight : flights.getFlights()) {
+        state.statuses[flight->getFlightNo()] = flight->getStatus();
+        state.crewPerFlight[flight->getFlightNo()] = flight->getFlightJson()["crewIDs"].size();
+    }
+    for (const auto& member : flights.getCrewMembers()) state.crewHours[member->getId()] = member->getTotalFlightHours();
+    return state;
+}
+
+int main() {
+    const fs::path dir = fs::absolute("JournalReplayTest.db");
+    makeDatabase(dir);
+    const fs::path home = fs::current_path();
+    fs::current_path(dir);
+
+    std::streambuf* out = std::cout.rdbuf();
+    std::ostringstream quiet;
+    std::cout.rdbuf(quiet.rdbuf());
+
+    int failures = 0;
+    auto check = [&failures, out](bool ok, const std::string& what) {
+        if (!ok) {
+            failures++;
+            std::ostream(out) << "FAIL: " << what << "\n";
+        }
+    };
+
+    State before;
+    {
+        // Never destroyed: no checkpoint and no shutdown merge, as after a crash
+        auto* aircraftSystem = new AircraftsSystem();
+        auto* flightSystem = new FlightSystem(*aircraftSystem);
+        const FlightStatus cycle[] = {FlightStatus::delayed, FlightStatus::onTime, FlightStatus::canceled};
+        for (int round = 0; round < 2; round++) {
+            for (int i = 0; i < flightCount; i++) flightSystem->updateFlightStatus(1000 + i, cycle[(i + round) % 3]);
+        }
+        check(flightSystem->assignCrew(1000, {crewCount + 1}).ok, "assign a new crew member before the crash");
+
+        // Headless adds check their crew as assignCrew does: crew 1 flies 4 of 5 hours, so one more flight is the last
+        FlightRecord added;
+        added.origin = "CAI";
+        added.destination = "JED";
+        added.aircraftModel = "A320";
+        added.departureTime = std::chrono::time_point_cast<std::chrono::minutes>(std::chrono::system_clock::now()) + std::chrono::hours(24 * 40);
+        added.arrivalTime = added.departureTime + std::chrono::hours(2);
+        added.flightNumber = 2000;
+        added.crewIDs = {1};
+        check(flightSystem->addFlight(added).ok, "add a flight with an available crew member");
+        added.flightNumber = 2001;
+        check(!flightSystem->addFlight(added).ok, "a crew member past the hour limit is refused");
+        added.crewIDs = {9999};
+        check(!flightSystem->addFlight(added).ok, "an unknown crew id is refused");
+        check(!flightSystem->getFlightByNumber(2001), "a refused flight is not added");
+        before = stateOf(*flightSystem);
+    }
+
+    try {
+        AircraftsSystem aircraftSystem;
+        FlightSystem flightSystem(aircraftSystem);
+        const State after = stateOf(flightSystem);
+        check(after.statuses == before.statuses, "every flight's status is replayed");
+        check(after.crewPerFlight == before.crewPerFlight, "crew lists are replayed, no member attached twice");
+        check(after.crewHours == before.crewHours, "crew hours are not counted twice");
+        auto first = flightSystem.getFlightByNumber(1000);
+        check(first && first->hasCrew(crewCount + 1), "crew assigned before the crash is back");
+        auto added = flightSystem.getFlightByNumber(2000);
+        check(added && added->hasCrew(1), "a flight added with crew before the crash is back");
+    } catch (const std::exception& e) {
+        check(false, std::string("reopening after the crash threw: ") + e.what());
+    }
+
+    std::cout.rdbuf(out);
+    fs::current_path(home);
+    std::printf("JournalReplayTest: %s\n", failures == 0 ? "passed" : "FAILED");
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,97 @@
+// Object pool test : slot reuse bumps the generation so stale handles read as gone, objects
+// never move, constructors that throw leave the pool unchanged, and destructors run exactly once.
+// Build & run with:  make test
+#include "../Include/ObjectPool.hpp"
+#include <cstdio>
+#include <iterator>
+#include <map>
+#include <random>
+#include <stdexcept>
+#include <string>
+
+namespace {
+    int liveObjects = 0;
+
+    struct Tracked {
+        int value;
+        explicit Tracked(int v) : value(v) {
+            if (v < 0) throw std::runtime_error("refused");
+            liveObjects++;
+        }
+        ~Tracked() { liveObjects--; }
+    };
+}
+
+int main() {
+    int failures = 0;
+    auto check = [&](bool ok, const std::string& what) {
+        if (!ok) {
+            if (failures < 20) std::printf("FAIL: %s\n", what.c_str());
+            failures++;
+        }
+    };
+
+    {
+        ObjectPool<Tracked, 8> pool;       // small chunks so the test crosses chunk boundaries
+
+        // --- A freed slot is reused by the next create, under a new generation :
+        PoolHandle first = pool.create(1);
+        check(first && pool.get(first) && pool.get(first)->value == 1, "create / get");
+        check(pool.destroy(first) && !pool.get(first) && !pool.destroy(first), "destroy once");
+        PoolHandle second = pool.create(2);
+        check(second.index == first.index && second.generation != first.generation, "slot reused with a new generation");
+        check(!pool.get(first) && pool.get(second)->value == 2, "stale handle stays dead after reuse");
+        check(!pool.get(PoolHandle()) && !pool.get(PoolHandle{1000, 1}), "invalid and out of range handles");
+
+        // --- A throwing constructor takes no slot :
+        bool threw = false;
+        try {
+            pool.create(-1);
+        } catch (const std::runtime_error&) {
+            threw = true;
+        }
+        check(threw && pool.size() == 1, "throwing constructor leaves the pool unchanged");
+        PoolHandle third = pool.create(3);
+        check(third.index == second.index + 1, "next slot after a failed create");
+
+        // --- Random churn against a model: live handles resolve, objects never move, dead ones stay dead :
+        std::mt19937 rng(5);
+        std::map<int, std::pair<PoolHandle, Tracked*>> live;     // value -> handle, address at creation
+        std::vector<PoolHandle> dead = {first};
+        live[2] = {second, pool.get(second)};
+        live[3] = {third, pool.get(third)};
+        for (int step = 0, next = 4; step < 5000; step++) {
+            if (live.empty() || rng() % 5 < 3) {
+                PoolHandle h = pool.create(next);
+                live[next] = {h, pool.get(h)};
+                next++;
+            } else {
+                auto it = live.begin();
+                std::advance(it, rng() % live.size());
+                check(pool.destroy(it->second.first), "destroy live handle");
+                dead.push_back(it->second.first);
+                live.erase(it);
+            }
+        }
+        for (const auto& entry : live) {
+            Tracked* now = pool.get(entry.second.first);
+            check(now == entry.second.second && now->value == entry.first, "live object " + std::to_string(entry.first));
+        }
+        for (PoolHandle h : dead) check(!pool.get(h), "dead handle " + std::to_string(h.index));
+        check(pool.size() == live.size() && liveObjects == static_cast<int>(live.size()), "live count");
+
+        int visited = 0;
+        pool.forEach([&](const Tracked&) { visited++; });
+        check(visited == static_cast<int>(live.size()), "forEach visits every live object");
+        check(pool.capacity() % 8 == 0 && pool.capacity() >= pool.size(), "capacity in whole chunks");
+
+        pool.clear();
+        check(pool.size() == 0 && liveObjects == 0 && !pool.get(third), "clear destroys everything");
+        pool.create(7);
+        pool.create(8);
+    }
+    check(liveObjects == 0, "pool destructor destroys the rest");
+
+    std::printf("ObjectPoolTest: %s\n", failures == 0 ? "passed" : "FAILED");
+    return failures == 0 ? 0 : 1;
+}
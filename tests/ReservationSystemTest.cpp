@@ -0,0 +1,318 @@
+// Reservation system test : books, cancels and moves reservations through the headless API and
+// checks the per-passenger index, the flight manifests, batch check-in and the live metrics
+// counters, both live and after the database is reopened from its journal.
+// Build & run with:  make test
+#include "../Include/Reservation.hpp"
+#include "../Include/Flight.hpp"
+#include "../Include/UserSystem.hpp"
+#include "../Include/Persistence.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <filesystem>
+#include <map>
+#include <set>
+#include <sstream>
+
+namespace fs = std::filesystem;
+
+const int passengerCount = 12;
+const int firstFlight = 1000;
+const int flightCount = 3;
+
+template <typename Record>
+void writeTable(const std::string& path, const std::vector<Record>& records) {
+    nlohmann::json jArray = nlohmann::json::array();
+    for (const auto& r : records) jArray.push_back(toJson(r));
+    writeFileAtomic(path, jArray.dump(4));
+}
+
+// --- flightCount flights of one 180-seat model, passengerCount passengers, no reservations yet
+void makeDatabase(const fs::path& dir) {
+    fs::remove_all(dir);
+    fs::create_directories(dir / "Database");
+    if (!fs::exists(dir / "database")) fs::create_directory_symlink("Database", dir / "database");
+
+    auto now = std::chrono::system_clock::now();
+    auto days = [](int n) { return std::chrono::hours(24 * n); };
+
+    AircraftRecord aircraft;
+    aircraft.model = "A320";
+    aircraft.capacity = 180;
+    aircraft.lastMaintenance = now - days(30);
+    aircraft.nextMaintenance = now + days(365);
+
+    std::vector<UserRecord> users;
+    for (int i = 1; i <= passengerCount; i++) {
+        users.push_back({i, "Passenger " + std::to_string(i), "p" + std::to_string(i) + "@test", "pw", Role::passenger});
+    }
+
+    const char* routes[flightCount][2] = {{"CAI", "DXB"}, {"CAI", "LHR"}, {"DXB", "CAI"}};
+    std::vector<FlightRecord> flights;
+    const timeType base = std::chrono::time_point_cast<std::chrono::minutes>(now) + days(20);
+    for (int i = 0; i < flightCount; i++) {
+        FlightRecord f;
+        f.flightNumber = firstFlight + i;
+        f.origin = routes[i][0];
+        f.destination = routes[i][1];
+        f.aircraftModel = aircraft.model;
+        f.departureTime = base + std::chrono::hours(5 * i);
+        f.arrivalTime = f.departureTime + std::chrono::hours(4);
+        flights.push_back(f);
+    }
+
+    writeTable((dir / "Database/Aircrafts.json").string(), std::vector<AircraftRecord>{aircraft});
+    writeTable((dir / "Database/Crew.json").string(), std::vector<CrewRecord>{});
+    writeTable((dir / "Database/Users.json").string(), users);
+    writeTable((dir / "Database/Flights.json").string(), flights);
+    writeTable((dir / "Database/Reservations.json").string(), std::vector<ReservationRecord>{});
+}
+
+// --- The whole stack, loaded from the current directory
+struct Systems {
+    AircraftsSystem aircraft;
+    UserSystem users;
+    FlightSystem flights{aircraft};
+    ReservationSystem reservations{flights, users};
+};
+
+std::vector<int> idsOf(const std::vector<Reservation*>& reservations) {
+    std::vector<int> ids;
+    for (Reservation* r : reservations) ids.push_back(r->getReservationId());
+    return ids;
+}
+
+int main() {
+    const fs::path dir = fs::absolute("ReservationSystemTest.db");
+    makeDatabase(dir);
+    const fs::path home = fs::current_path();
+    fs::current_path(dir);
+
+    std::streambuf* out = std::cout.rdbuf();
+    std::ostringstream quiet;
+    std::cout.rdbuf(quiet.rdbuf());
+
+    int failures = 0;
+    auto check = [&failures, out](bool ok, const std::string& what) {
+        if (!ok) {
+            failures++;
+            std::ostream(out) << "FAIL: " << what << "\n";
+        }
+    };
+
+    std::map<int, std::set<int>> byPassenger;       // model: passenger -> reservation ids still booked
+    std::map<int, std::pair<int, int>> seatOf;      // model: reservation id -> (flight, seat)
+    std::set<int> checkedIn;                        // model: reservation ids checked in
+    auto checkPassengerIndex = [&](const ReservationSystem& reservations, const std::string& when) {
+        for (int p = 1; p <= passengerCount + 1; p++) {
+            const std::set<int>& expected = byPassenger[p];
+            check(idsOf(reservations.getReservationsOf(p)) == std::vector<int>(expected.begin(), expected.end()),
+                  "reservations of passenger " + std::to_string(p) + " " + when);
+        }
+    };
+
+    // --- Each flight's manifest lists exactly its reservations, by seat then reservation id :
+    auto checkManifests = [&](const ReservationSystem& reservations, const std::string& when) {
+        for (int f = firstFlight; f < firstFlight + flightCount; f++) {
+            const std::vector<ManifestEntry> manifest = reservations.getManifest(f);
+            const std::string tag = "manifest of flight " + std::to_string(f) + " " + when;
+            std::size_t expected = 0;
+            for (const auto& entry : seatOf) expected += entry.second.first == f;
+            check(manifest.size() == expected && reservations.manifestSize(f) == expected, tag + ": size");
+            for (std::size_t i = 0; i < manifest.size(); i++) {
+                const ManifestEntry& e = manifest[i];
+                auto model = seatOf.find(e.reservationId);
+                check(model != seatOf.end() && model->second == std::make_pair(f, e.seatNumber), tag + ": seat of " +
+                      std::to_string(e.reservationId));
+                check(byPassenger[e.passengerId].count(e.reservationId) &&
+                      e.passengerName == "Passenger " + std::to_string(e.passengerId), tag + ": passenger of " +
+                      std::to_string(e.reservationId));
+                check(e.checkedIn == (checkedIn.count(e.reservationId) > 0), tag + ": check-in flag of " +
+                      std::to_string(e.reservationId));
+                if (i > 0) {
+                    const ManifestEntry& prev = manifest[i - 1];
+                    check(prev.seatNumber < e.seatNumber || (prev.seatNumber == e.seatNumber && prev.reservationId < e.reservationId),
+                          tag + ": order at " + std::to_string(i));
+                }
+            }
+        }
+        check(reservations.getManifest(4242).empty() && reservations.manifestSize(4242) == 0, "manifest of an unknown flight");
+    };
+
+    try {
+        Systems s;
+
+        // ---------------------------- Per-passenger index ---------------------------- //
+        for (int i = 0; i < 40; i++) {
+            BookingRequest request;
+            request.passengerId = 1 + i % 5;
+            request.flightNumber = firstFlight + i % flightCount;
+            request.method = "Visa";
+            request.details = "test";
+            request.amount = 100 + i;
+            BookingResult result = s.reservations.book(request);
+            check(result.ok(), "booking " + std::to_string(i));
+            if (result.ok()) {
+                byPassenger[request.passengerId].insert(result.reservationId);
+                seatOf[result.reservationId] = {request.flightNumber, result.seatNumber};
+            }
+        }
+        BookingRequest unknown;
+        unknown.passengerId = 999;
+        unknown.flightNumber = firstFlight;
+        check(s.reservations.book(unknown).status == BookingStatus::unknownPassenger, "unknown passenger refused");
+        checkPassengerIndex(s.reservations, "after booking");
+
+        // Cancel every third reservation of each passenger; moving a seat keeps the owner
+        for (auto& entry : byPassenger) {
+            std::vector<int> ids(entry.second.begin(), entry.second.end());
+            for (std::size_t k = 0; k < ids.size(); k += 3) {
+                check(s.reservations.cancelBooking(ids[k]), "cancel " + std::to_string(ids[k]));
+                entry.second.erase(ids[k]);
+                seatOf.erase(ids[k]);
+            }
+        }
+        check(!s.reservations.cancelBooking(*byPassenger[1].begin() + 100000), "cancelling an unknown id fails");
+        const int moved = *byPassenger[2].begin();
+        check(s.reservations.changeSeat(moved, 177).ok(), "change seat");
+        seatOf[moved].second = 177;
+        checkPassengerIndex(s.reservations, "after cancelling and moving");
+
+        // ---------------------------- Flight manifests ---------------------------- //
+        // Seats booked back to front, so the manifest has to sort them
+        for (int seat = 60; seat > 50; seat--) {
+            BookingRequest request;
+            request.passengerId = 6 + seat % 4;
+            request.flightNumber = firstFlight + 2;
+            request.seatNumber = seat;
+            request.method = "Cash";
+            request.amount = 50;
+            BookingResult result = s.reservations.book(request);
+            check(result.ok() && result.seatNumber == seat, "booking seat " + std::to_string(seat));
+            if (result.ok()) {
+                byPassenger[request.passengerId].insert(result.reservationId);
+                seatOf[result.reservationId] = {request.flightNumber, seat};
+            }
+        }
+        BookingRequest taken;
+        taken.passengerId = 1;
+        taken.flightNumber = firstFlight + 2;
+        taken.seatNumber = 55;
+        check(s.reservations.book(taken).status == BookingStatus::seatTaken, "a taken seat is refused");
+        checkManifests(s.reservations, "after booking");
+
+        // ---------------------------- Batch check-in ---------------------------- //
+        // By id: each id lands in exactly one outcome, in request order; a repeated id is already checked in
+        std::vector<int> onFirst;
+        for (const auto& entry : seatOf) {
+            if (entry.second.first == firstFlight) onFirst.push_back(entry.first);
+        }
+        const std::vector<int> group = {onFirst[0], onFirst[1], 999999, onFirst[2], onFirst[0]};
+        CheckInResult result = s.reservations.checkIn(group);
+        check(result.checkedIn == std::vector<int>{onFirst[0], onFirst[1], onFirst[2]}, "group check-in: checked in");
+        check(result.alreadyCheckedIn == std::vector<int>{onFirst[0]}, "group check-in: repeated id");
+        check(result.notFound == std::vector<int>{999999}, "group check-in: unknown id");
+        checkedIn.insert(onFirst.begin(), onFirst.begin() + 3);
+        result = s.reservations.checkIn({onFirst[1]});
+        check(result.checkedIn.empty() && result.alreadyCheckedIn == std::vector<int>{onFirst[1]}, "checking in twice");
+        check(s.reservations.checkIn({}).checkedIn.empty(), "empty group");
+
+        // Whole flight: everyone not yet checked in, then nobody
+        std::set<int> onSecond;
+        for (const auto& entry : seatOf) {
+            if (entry.second.first == firstFlight + 1) onSecond.insert(entry.first);
+        }
+        result = s.reservations.checkInFlight(firstFlight + 1);
+        check(std::set<int>(result.checkedIn.begin(), result.checkedIn.end()) == onSecond &&
+              result.checkedIn.size() == onSecond.size() && result.alreadyCheckedIn.empty(), "flight check-in");
+        checkedIn.insert(onSecond.begin(), onSecond.end());
+        result = s.reservations.checkInFlight(firstFlight + 1);
+        check(result.checkedIn.empty() && result.alreadyCheckedIn.size() == onSecond.size(), "flight checked in twice");
+        result = s.reservations.checkInFlight(4242);
+        check(result.checkedIn.empty() && result.alreadyCheckedIn.empty() && result.notFound.empty(), "unknown flight");
+        check(s.reservations.findReservation(onFirst[0])->isCheckedIn() && !s.reservations.findReservation(onFirst[3])->isCheckedIn(),
+              "isCheckedIn");
+        checkManifests(s.reservations, "after check-in");
+
+        // ---------------------------- Metrics counters ---------------------------- //
+        const MetricsRegistry& metrics = s.flights.getMetrics();
+        const int flight = firstFlight + 2;
+        const long reservationsBefore = metrics.totalReservations();
+        const long long revenueBefore = metrics.totalRevenue();
+        const FlightMetrics flightBefore = metrics.flight(flight);
+        check(reservationsBefore == static_cast<long>(seatOf.size()), "reservation counter matches the bookings so far");
+
+        std::vector<int> added;
+        for (int amount : {300, 400, 500}) {
+            BookingRequest request;
+            request.passengerId = 11;
+            request.flightNumber = flight;
+            request.method = "Visa";
+            request.amount = amount;
+            BookingResult booked = s.reservations.book(request);
+            check(booked.ok(), "metrics booking " + std::to_string(amount));
+            if (!booked.ok()) continue;
+            added.push_back(booked.reservationId);
+            byPassenger[11].insert(booked.reservationId);
+            seatOf[booked.reservationId] = {flight, booked.seatNumber};
+        }
+        taken.amount = 10000;
+        check(!s.reservations.book(taken).ok(), "refused booking for the metrics check");
+        if (added.size() != 3) throw std::runtime_error("metrics bookings failed");
+        check(s.reservations.cancelBooking(added[1]), "metrics cancel");
+        byPassenger[11].erase(added[1]);
+        seatOf.erase(added[1]);
+
+        check(metrics.totalReservations() == reservationsBefore + 2, "reservations: +3 booked, -1 cancelled, refused not counted");
+        check(metrics.totalRevenue() == revenueBefore + 800, "revenue: +1200 booked, -400 cancelled");
+        const FlightMetrics flightAfter = metrics.flight(flight);
+        check(flightAfter.reservations == flightBefore.reservations + 2 && flightAfter.revenue == flightBefore.revenue + 800
+              && flightAfter.seats == 180 && flightAfter.listed, "per-flight counters");
+        const std::vector<RouteMetrics> routes = metrics.revenueByRoute();
+        auto route = std::find_if(routes.begin(), routes.end(), [](const RouteMetrics& r) {
+            return r.origin.str() == "DXB" && r.destination.str() == "CAI";
+        });
+        check(route != routes.end() && route->revenue == flightAfter.revenue && route->reservations == flightAfter.reservations,
+              "route counters");
+
+        const long scheduled = metrics.flightsWithStatus(FlightStatus::scheduled);
+        const long delayed = metrics.flightsWithStatus(FlightStatus::delayed);
+        check(s.flights.updateFlightStatus(firstFlight + 1, FlightStatus::delayed).ok, "status change");
+        check(s.flights.updateFlightStatus(firstFlight + 1, FlightStatus::delayed).ok, "same status again");
+        check(metrics.flightsWithStatus(FlightStatus::scheduled) == scheduled - 1 &&
+              metrics.flightsWithStatus(FlightStatus::delayed) == delayed + 1 && metrics.totalFlights() == flightCount,
+              "status counters move once");
+
+        const std::vector<FlightMetrics> fullest = metrics.fullestFlights(2);
+        check(fullest.size() == 2 && fullest[0].loadFactor() >= fullest[1].loadFactor(), "fullest flights, highest first");
+        for (const FlightMetrics& f : fullest) {
+            check(f.reservations == static_cast<int>(s.reservations.manifestSize(f.flightNumber)), "fullest flight " +
+                  std::to_string(f.flightNumber) + " counts its manifest");
+        }
+    } catch (const std::exception& e) {
+        check(false, std::string("first session threw: ") + e.what());
+    }
+
+    try {
+        Systems s;      // reopened: the indexes are rebuilt from the file and its journal
+        checkPassengerIndex(s.reservations, "after reopening");
+        checkManifests(s.reservations, "after reopening");
+
+        // Counters are rebuilt by the same load path
+        const MetricsRegistry& metrics = s.flights.getMetrics();
+        check(metrics.totalReservations() == static_cast<long>(seatOf.size()), "reservation counter after reopening");
+        check(metrics.flightsWithStatus(FlightStatus::delayed) == 1 && metrics.totalFlights() == flightCount,
+              "status counters after reopening");
+        for (int f = firstFlight; f < firstFlight + flightCount; f++) {
+            check(metrics.flight(f).reservations == static_cast<int>(s.reservations.manifestSize(f)),
+                  "flight " + std::to_string(f) + " counter after reopening");
+        }
+    } catch (const std::exception& e) {
+        check(false, std::string("reopening threw: ") + e.what());
+    }
+
+    std::cout.rdbuf(out);
+    fs::current_path(home);
+    fs::remove_all(dir);
+    std::printf("ReservationSystemTest: %s\n", failures == 0 ? "passed" : "FAILED");
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,102 @@
+// Route index test : files flights over a few routes and days, erases and re-files some, and
+// checks find / findInRange / findFrom against a scan over the flights still listed.
+// Build & run with:  make test
+#include "../Include/Flight.hpp"
+#include "../Include/RouteIndex.hpp"
+#include "../Include/TimeZones.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <map>
+#include <random>
+
+int main() {
+    int failures = 0;
+    auto check = [&](bool ok, const std::string& what) {
+        if (!ok) {
+            if (failures < 20) std::printf("FAIL: %s\n", what.c_str());
+            failures++;
+        }
+    };
+
+    const std::vector<std::string> airports = {"CAI", "DXB", "LHR", "JFK"};
+    auto aircraft = std::make_shared<Aircraft>("A320", 180);
+    const timeType base = std::chrono::time_point_cast<std::chrono::minutes>(std::chrono::system_clock::now());
+    std::mt19937 rng(3);
+    auto pick = [&](int n) { return std::uniform_int_distribution<int>(0, n - 1)(rng); };
+
+    auto makeFlight = [&](int number) {
+        const std::string& origin = airports[pick(4)];
+        std::string destination = airports[pick(4)];
+        if (destination == origin) destination = "BEY";
+        const timeType departure = base + std::chrono::minutes(pick(14 * 24 * 60));
+        return std::make_shared<Flight>(number, origin, destination, FlightStatus::scheduled, aircraft,
+                                        departure, departure + std::chrono::hours(3));
+    };
+
+    RouteIndex index;
+    std::map<int, std::shared_ptr<Flight>> listed;
+    for (int number = 1; number <= 400; number++) {
+        auto flight = makeFlight(number);
+        index.insert(flight);
+        listed[number] = flight;
+    }
+    // Drop every fifth flight, re-file every seventh under a new route and time
+    for (int number = 5; number <= 400; number += 5) {
+        index.erase(number);
+        listed.erase(number);
+    }
+    for (int number = 7; number <= 400; number += 7) {
+        auto flight = makeFlight(number);
+        index.update(flight);
+        listed[number] = flight;
+    }
+    index.erase(99999);     // unknown flight: no-op
+
+    auto numbers = [](const std::vector<std::shared_ptr<Flight>>& flights) {
+        std::vector<int> out;
+        for (const auto& f : flights) out.push_back(f->getFlightNo());
+        std::sort(out.begin(), out.end());
+        return out;
+    };
+    auto expect = [&](const std::string& origin, const std::string* destination, int firstDay, int lastDay) {
+        std::vector<int> out;
+        for (const auto& entry : listed) {
+            const Flight& f = *entry.second;
+            if (f.getOrigin() == origin && (!destination || f.getDestination() == *destination)
+                && f.getDepartureDay() >= firstDay && f.getDepartureDay() <= lastDay)
+                out.push_back(entry.first);
+        }
+        return out;
+    };
+
+    const int today = localDayAt("CAI", base);
+    for (const std::string& origin : airports) {
+        for (const std::string& destination : {std::string("CAI"), std::string("DXB"), std::string("LHR"),
+                                               std::string("JFK"), std::string("BEY")}) {
+            for (int day = today - 2; day <= today + 16; day++) {
+                const std::string tag = origin + "->" + destination + " day " + std::to_string(day);
+                check(numbers(index.find(intern(origin), intern(destination), day)) == expect(origin, &destination, day, day),
+                      "find " + tag);
+                check(numbers(index.findInRange(intern(origin), intern(destination), day, day + 3))
+                      == expect(origin, &destination, day, day + 3), "findInRange " + tag);
+            }
+            check(index.findInRange(intern(origin), intern(destination), today + 3, today).empty(), "empty range");
+        }
+        for (int day = today - 2; day <= today + 16; day++) {
+            check(numbers(index.findFrom(intern(origin), day, day + 2)) == expect(origin, nullptr, day, day + 2),
+                  "findFrom " + origin + " day " + std::to_string(day));
+        }
+    }
+
+    // The range lookup returns flights in day order
+    auto ordered = index.findInRange(intern("CAI"), intern("DXB"), today, today + 14);
+    check(std::is_sorted(ordered.begin(), ordered.end(), [](const auto& a, const auto& b) {
+        return a->getDepartureDay() < b->getDepartureDay();
+    }), "findInRange ordered by day");
+
+    index.clear();
+    check(index.findFrom(intern("CAI"), today - 30, today + 30).empty(), "clear");
+
+    std::printf("RouteIndexTest: %s\n", failures == 0 ? "passed" : "FAILED");
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,85 @@
+// SeatMap test : books and frees seats at random on maps of several sizes (word boundaries
+// included) and checks every bit query and row / cabin query against a plain bool-per-seat model.
+// Build & run with:  make test
+#include "../Include/Flight.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <random>
+
+int main() {
+    int failures = 0;
+    auto check = [&](bool ok, const std::string& what) {
+        if (!ok) {
+            if (failures < 20) std::printf("FAIL: %s\n", what.c_str());
+            failures++;
+        }
+    };
+
+    // --- Reference answers from the model (seats numbered from 1, 0 = none) :
+    auto firstFree = [](const std::vector<bool>& model, int first, int last) {
+        for (int s = std::max(first, 1); s <= std::min<int>(last, model.size() - 1); s++)
+            if (model[s]) return s;
+        return 0;
+    };
+    auto countFree = [](const std::vector<bool>& model, int first, int last) {
+        int n = 0;
+        for (int s = std::max(first, 1); s <= std::min<int>(last, model.size() - 1); s++) n += model[s];
+        return n;
+    };
+
+    std::mt19937 rng(20240501);
+    for (int total : {1, 6, 63, 64, 65, 127, 128, 180, 200, 853}) {
+        for (int rowSize : {1, 4, 6, 10}) {
+            SeatMap map(total, rowSize);
+            std::vector<bool> model(total + 1, true);
+            model[0] = false;
+            const std::string tag = "seats=" + std::to_string(total) + " row=" + std::to_string(rowSize) + " ";
+
+            check(map.seatsCount() == total && map.getTotalSeats() == total, tag + "starts all free");
+            check(map.rowCount() == (total + rowSize - 1) / rowSize, tag + "rowCount");
+            check(!map.bookSeat(0) && !map.bookSeat(total + 1) && !map.unbookSeat(total + 1), tag + "out of range seats refused");
+            check(!map.unbookSeat(1), tag + "freeing a free seat refused");
+
+            for (int step = 0; step < 4 * total + 50; step++) {
+                const int seat = std::uniform_int_distribution<int>(1, total)(rng);
+                if (rng() % 3) {
+                    check(map.bookSeat(seat) == model[seat], tag + "bookSeat " + std::to_string(seat));
+                    model[seat] = false;
+                } else {
+                    check(map.unbookSeat(seat) == !model[seat], tag + "unbookSeat " + std::to_string(seat));
+                    model[seat] = true;
+                }
+
+                check(map.seatsCount() == countFree(model, 1, total), tag + "free counter");
+                check(map.isSeatFree(seat) == model[seat], tag + "isSeatFree");
+                int a = std::uniform_int_distribution<int>(-2, total + 2)(rng);
+                int b = std::uniform_int_distribution<int>(-2, total + 2)(rng);
+                check(map.firstFreeSeat(a) == firstFree(model, a, total), tag + "firstFreeSeat");
+                check(map.firstFreeInRange(a, b) == firstFree(model, a, b), tag + "firstFreeInRange");
+                check(map.freeSeatsInRange(a, b) == countFree(model, a, b), tag + "freeSeatsInRange");
+
+                const int row = std::uniform_int_distribution<int>(1, map.rowCount())(rng);
+                const int lastRow = std::uniform_int_distribution<int>(row, map.rowCount())(rng);
+                check(map.rowOf(seat) == (seat - 1) / rowSize + 1, tag + "rowOf");
+                check(map.firstFreeInRow(row) == firstFree(model, (row - 1) * rowSize + 1, row * rowSize), tag + "firstFreeInRow");
+                check(map.freeSeatsInRow(row) == countFree(model, (row - 1) * rowSize + 1, row * rowSize), tag + "freeSeatsInRow");
+                check(map.firstFreeInCabin(row, lastRow) == firstFree(model, (row - 1) * rowSize + 1, lastRow * rowSize),
+                      tag + "firstFreeInCabin");
+                check(map.freeSeatsInCabin(row, lastRow) == countFree(model, (row - 1) * rowSize + 1, lastRow * rowSize),
+                      tag + "freeSeatsInCabin");
+            }
+
+            // Fill it up: no free seat anywhere, then reset
+            for (int s = 1; s <= total; s++) map.bookSeat(s);
+            check(map.seatsCount() == 0 && map.firstFreeSeat() == 0 && map.freeSeatsInCabin(1, map.rowCount()) == 0,
+                  tag + "full map");
+            map.resetMap();
+            check(map.seatsCount() == total && map.firstFreeSeat() == 1 && map.freeSeatsInRange(1, total) == total,
+                  tag + "resetMap");
+            check(map.rowOf(0) == 0 && map.firstFreeInCabin(3, 2) == 0, tag + "invalid row / seat queries");
+        }
+    }
+
+    std::printf("SeatMapTest: %s\n", failures == 0 ? "passed" : "FAILED");
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,61 @@
+// Time zone test : checks localDayAt on both sides of the 2025 daylight-saving changes (times
+// from the IANA tzdata) and that localMidnightAt starts every day of 2020 - 2030 at the right instant.
+// Build & run with:  make test
+#include "../Include/TimeZones.hpp"
+#include <cstdio>
+
+int main() {
+    int failures = 0;
+    auto check = [&](bool ok, const std::string& what) {
+        if (!ok) {
+            if (failures < 20) std::printf("FAIL: %s\n", what.c_str());
+            failures++;
+        }
+    };
+
+    // --- UTC instant -> local calendar date expected at the airport :
+    struct Case { const char* airport; const char* utc; const char* localDate; };
+    const Case cases[] = {
+        // London: BST from 2025-03-30 01:00 UTC to 2025-10-26 01:00 UTC
+        {"LHR", "2025-03-29 23:30", "2025-03-29"}, {"LHR", "2025-03-30 23:30", "2025-03-31"},
+        {"LHR", "2025-10-25 23:30", "2025-10-26"}, {"LHR", "2025-10-26 23:30", "2025-10-26"},
+        // New York: EDT from 2025-03-09 07:00 UTC to 2025-11-02 06:00 UTC
+        {"JFK", "2025-03-09 04:30", "2025-03-08"}, {"JFK", "2025-03-10 04:30", "2025-03-10"},
+        {"JFK", "2025-11-02 04:30", "2025-11-02"}, {"JFK", "2025-11-03 04:30", "2025-11-02"},
+        // Cairo: EEST from Fri 2025-04-25 00:00 local to the end of Thu 2025-10-30
+        {"CAI", "2025-04-24 21:30", "2025-04-24"}, {"CAI", "2025-04-24 22:30", "2025-04-25"},
+        {"Cairo", "2025-07-15 21:30", "2025-07-16"}, {"CAI", "2025-10-30 20:30", "2025-10-30"},
+        {"CAI", "2025-10-30 21:30", "2025-10-30"}, {"CAI", "2025-10-30 22:30", "2025-10-31"},
+        {"CAI", "2022-07-15 21:30", "2022-07-15"},          // no daylight time 2015 - 2022
+        // Beirut: EEST from Sun 2025-03-30 00:00 local to Sun 2025-10-26 00:00 local
+        {"BEY", "2025-03-29 21:30", "2025-03-29"}, {"BEY", "2025-03-29 22:30", "2025-03-30"},
+        {"BEY", "2025-10-25 20:30", "2025-10-25"}, {"BEY", "2025-10-25 21:30", "2025-10-25"},
+        {"BEY", "2025-10-25 22:30", "2025-10-26"},
+        // No daylight time, and airports missing from the table (UTC)
+        {"DXB", "2025-06-01 19:59", "2025-06-01"}, {"DXB", "2025-06-01 20:00", "2025-06-02"},
+        {"Nowhere", "2025-06-01 23:59", "2025-06-01"},
+    };
+    for (const Case& c : cases) {
+        check(localDayAt(c.airport, parseDate(c.utc)) == toUtcDay(parseDate(c.localDate)),
+              std::string(c.airport) + " at " + c.utc + " UTC should be " + c.localDate);
+    }
+
+    // --- Every local day starts at localMidnightAt: the second before belongs to the previous day
+    //     (across spring-forward gaps too, where the day starts when the clocks resume) :
+    const int firstDay = daysFromCivil(2020, 1, 1), lastDay = daysFromCivil(2030, 12, 31);
+    for (const char* airport : {"LHR", "CDG", "JFK", "ORD", "CAI", "BEY", "DXB", "BOM", "Nowhere"}) {
+        for (int day = firstDay; day <= lastDay; day++) {
+            const timeType start = localMidnightAt(airport, day);
+            const bool ok = localDayAt(airport, start) == day && localDayAt(airport, start - std::chrono::seconds(1)) == day - 1;
+            check(ok, std::string("localMidnightAt ") + airport + " " + formatDateTime(timeType(std::chrono::hours(24) * day)));
+        }
+    }
+
+    check(utcOffsetMinutesAt(nullptr, parseDate("2025-07-01")) == 0, "unknown zone is UTC");
+    const AirportZone* beirut = findAirportZone("Beirut");
+    check(beirut && beirut->utcOffsetMinutes == 120 && beirut->dst == DstRule::lebanon && !findAirportZone("Nowhere"),
+          "zone lookup by city");
+
+    std::printf("TimeZoneTest: %s\n", failures == 0 ? "passed" : "FAILED");
+    return failures == 0 ? 0 : 1;
+}
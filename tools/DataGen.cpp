@@ -0,0 +1,319 @@
+// Writes a synthetic, self-consistent database for scale testing:
+//     DataGen [--flights N] [--passengers N] [--load F] [--days N] [--start YYYY-MM-DD] [--seed S] [--out DIR]
+// Defaults: 10000 flights, 100000 passengers, 0.8 average load factor, 90 days from today,
+// seed 1, output directory "GeneratedDB". The same seed and --start always give the same files.
+// Writes DIR/{Aircrafts,Crew,Users,Flights,Reservations}.json in the same format as Database/;
+// copy them over Database/ (or run from DIR's parent with DIR renamed to Database) to use them.
+//
+// What makes the data realistic enough for benchmarks:
+//   - airports are real cities weighted by traffic (hubs get most flights), routes never loop back
+//   - flight length follows great-circle distance, departures cluster on the morning/evening banks
+//   - the fleet mixes narrow and wide bodies, long routes get the wide bodies
+//   - each flight gets requiredPilots() pilots and cabin crew; like the loader, a crew member only
+//     takes a flight while their accumulated hours are under Crew's 5 h limit, more crew is hired as needed
+//   - each flight is filled around --load with distinct seats; frequent flyers book more often
+// Every reservation's passengerid and flightNumber resolve, every seat is within capacity.
+#include "../Include/Records.hpp"
+#include "../Include/Persistence.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <numeric>
+#include <random>
+
+namespace fs = std::filesystem;
+
+namespace {
+    struct Airport { const char* city; double lat; double lon; int weight; };
+    const Airport airports[] = {
+        {"Cairo", 30.1, 31.4, 90},     {"Dubai", 25.3, 55.4, 100},   {"London", 51.5, -0.5, 95},
+        {"Paris", 49.0, 2.5, 85},      {"Frankfurt", 50.0, 8.6, 80}, {"Istanbul", 41.3, 28.8, 85},
+        {"Doha", 25.3, 51.6, 70},      {"Riyadh", 24.9, 46.7, 50},   {"Jeddah", 21.7, 39.2, 55},
+        {"Amman", 31.7, 36.0, 25},     {"Beirut", 33.8, 35.5, 20},   {"Athens", 37.9, 23.9, 35},
+        {"Rome", 41.8, 12.3, 45},      {"Madrid", 40.5, -3.6, 50},   {"Amsterdam", 52.3, 4.8, 70},
+        {"New York", 40.6, -73.8, 90}, {"Chicago", 42.0, -87.9, 45}, {"Toronto", 43.7, -79.6, 35},
+        {"Mumbai", 19.1, 72.9, 55},    {"Delhi", 28.6, 77.1, 55},    {"Singapore", 1.4, 104.0, 65},
+        {"Bangkok", 13.7, 100.7, 50},  {"Tokyo", 35.8, 140.4, 60},   {"Nairobi", -1.3, 36.9, 20},
+        {"Johannesburg", -26.1, 28.2, 25}, {"Casablanca", 33.4, -7.6, 20}, {"Tunis", 36.9, 10.2, 15},
+        {"Kuwait", 29.2, 47.9, 25},    {"Muscat", 23.6, 58.3, 20},   {"Luxor", 25.7, 32.7, 10},
+    };
+    const int airportCount = sizeof(airports) / sizeof(airports[0]);
+
+    struct AircraftType { const char* name; int capacity; double maxRangeKm; int weight; };
+    const AircraftType fleetTypes[] = {
+        {"Airbus A220", 120, 5000, 10}, {"Airbus A320", 180, 6000, 35}, {"Boeing 737", 189, 5500, 30},
+        {"Airbus A321", 220, 7000, 15}, {"Boeing 787", 290, 14000, 6},  {"Airbus A350", 325, 15000, 3},
+        {"Boeing 777", 396, 14000, 1},
+    };
+    const int typeCount = sizeof(fleetTypes) / sizeof(fleetTypes[0]);
+
+    // Share of departures per hour of the day: morning and evening banks, quiet nights
+    const int departureHourWeights[24] = {2, 1, 1, 1, 2, 4, 9, 10, 9, 7, 6, 5, 5, 5, 6, 7, 8, 9, 10, 9, 7, 5, 4, 3};
+
+    const char* firstNames[] = {"Ahmed", "Menna", "Omar", "Sara", "Youssef", "Nour", "Ali", "Laila", "Karim", "Mona",
+                                "John", "Emma", "Lucas", "Mia", "Hiro", "Aiko", "Ravi", "Priya", "Carlos", "Ana"};
+    const char* lastNames[] = {"Hassan", "Mostafa", "Ibrahim", "Saleh", "Nasser", "Smith", "Brown", "Garcia",
+                               "Martin", "Rossi", "Tanaka", "Sharma", "Khan", "Silva", "Novak", "Cohen"};
+    const char* paymentMethods[] = {"Visa", "Credit Card", "Cash", "Paypal"};
+    const int paymentWeights[] = {45, 30, 10, 15};
+
+    struct Options {
+        long flights = 10000;
+        long passengers = 100000;
+        double load = 0.8;
+        int days = 90;
+        std::string start;          // empty: today
+        unsigned long long seed = 1;
+        std::string out = "GeneratedDB";
+    };
+
+    double distanceKm(const Airport& a, const Airport& b) {
+        const double toRad = 3.14159265358979323846 / 180.0;
+        double dLat = (b.lat - a.lat) * toRad, dLon = (b.lon - a.lon) * toRad;
+        double h = std::sin(dLat / 2) * std::sin(dLat / 2) +
+                   std::cos(a.lat * toRad) * std::cos(b.lat * toRad) * std::sin(dLon / 2) * std::sin(dLon / 2);
+        return 2 * 6371.0 * std::asin(std::sqrt(h));
+    }
+
+    template <std::size_t N>
+    std::discrete_distribution<int> weighted(const int (&weights)[N]) {
+        return std::discrete_distribution<int>(weights, weights + N);
+    }
+
+    // ------ Streams a JSON array row by row, laid out like nlohmann::json::dump(4) of the whole array ------ //
+    class JsonArrayWriter {
+    private:
+        std::string path;
+        std::ofstream out;
+        long rows = 0;
+
+    public:
+        explicit JsonArrayWriter(const std::string& path) : path(path), out(path + ".tmp", std::ios::binary) {
+            if (!out) throw std::runtime_error("Cannot write " + path);
+            out << "[";
+        }
+
+        void add(const nlohmann::json& row) {
+            std::string text = row.dump(4);
+            out << (rows++ ? ",\n    " : "\n    ");
+            for (char c : text) {
+                out << c;
+                if (c == '\n') out << "    ";
+            }
+        }
+
+        long close() {
+            out << (rows ? "\n]" : "]");
+            out.close();
+            if (!out) throw std::runtime_error("Write failed: " + path);
+            renameFileDurable(path + ".tmp", path);
+            return rows;
+        }
+    };
+
+    bool parseOptions(int argc, char** argv, Options& o) {
+        for (int i = 1; i + 1 < argc; i += 2) {
+            const char* name = argv[i];
+            const char* value = argv[i + 1];
+            if (!std::strcmp(name, "--flights")) o.flights = std::atol(value);
+            else if (!std::strcmp(name, "--passengers")) o.passengers = std::atol(value);
+            else if (!std::strcmp(name, "--load")) o.load = std::atof(value);
+            else if (!std::strcmp(name, "--days")) o.days = std::atoi(value);
+            else if (!std::strcmp(name, "--start")) o.start = value;
+            else if (!std::strcmp(name, "--seed")) o.seed = std::strtoull(value, nullptr, 10);
+            else if (!std::strcmp(name, "--out")) o.out = value;
+            else return false;
+        }
+        return argc % 2 == 1 && o.flights > 0 && o.passengers > 0 && o.days > 0 && o.load > 0.0 && o.load <= 1.0;
+    }
+}
+
+int main(int argc, char** argv) {
+    Options opt;
+    if (!parseOptions(argc, argv, opt)) {
+        std::cerr << "usage: DataGen [--flights N] [--passengers N] [--load 0..1] [--days N] [--start YYYY-MM-DD] [--seed S] [--out DIR]\n";
+        return 2;
+    }
+
+    try {
+        fs::create_directories(opt.out);
+        const std::string dir = opt.out + "/";
+        std::mt19937_64 rng(opt.seed);
+        std::uniform_real_distribution<double> unit(0.0, 1.0);
+
+        // ------ Fleet: about one aircraft per 4 daily flights, at least one of each type ------ //
+        const long flightsPerDay = std::max(1L, opt.flights / opt.days);
+        const long fleetSize = std::max<long>(typeCount, flightsPerDay / 4);
+        std::vector<int> typeWeights;
+        for (const auto& t : fleetTypes) typeWeights.push_back(t.weight);
+        std::discrete_distribution<int> pickType(typeWeights.begin(), typeWeights.end());
+
+        const timeType start = parseDate(opt.start.empty() ? formatDateTime(std::chrono::system_clock::now()).substr(0, 10) : opt.start);
+        std::vector<AircraftRecord> fleet(fleetSize);
+        std::vector<std::vector<long>> fleetByType(typeCount);
+        for (long i = 0; i < fleetSize; i++) {
+            int t = i < typeCount ? static_cast<int>(i) : pickType(rng);
+            fleetByType[t].push_back(i);
+            char tail[24];
+            std::snprintf(tail, sizeof(tail), "%04ld", i + 1);
+            fleet[i].model = std::string(fleetTypes[t].name) + " #" + tail;
+            fleet[i].capacity = fleetTypes[t].capacity;
+            fleet[i].lastMaintenance = start - std::chrono::hours(24 * (1 + static_cast<long>(rng() % 60)));
+            fleet[i].nextMaintenance = start + std::chrono::hours(24 * (opt.days + 180 + static_cast<long>(rng() % 180)));
+        }
+
+        // ------ Crew: hours are replayed the way FlightSystem's loader adds them (Crew::assignToFlight) ------ //
+        std::vector<CrewRecord> crew;
+        std::vector<double> crewHours;          // hours after the flights assigned so far
+        std::vector<int> pilots, cabin;
+        auto hire = [&](const std::string& role) {
+            CrewRecord c;
+            c.crewID = static_cast<int>(crew.size() + 1);
+            c.name = std::string(firstNames[rng() % 20]) + " " + lastNames[rng() % 16];
+            c.role = role;
+            c.totalFlightHours = static_cast<double>(rng() % 5) / 2.0;
+            crew.push_back(c);
+            crewHours.push_back(c.totalFlightHours);
+            (role == "Pilot" ? pilots : cabin).push_back(c.crewID);
+            return c.crewID;
+        };
+        const double crewHourLimit = 5.0;       // Crew::maxFlightHours
+        // A few random members of the role that are still under the limit and not on this flight yet, else a new hire
+        auto assignCrew = [&](FlightRecord& f, std::vector<int>& pool, const std::string& role, int hours) {
+            int id = 0;
+            for (int attempt = 0; attempt < 8 && !pool.empty() && id == 0; attempt++) {
+                int candidate = pool[rng() % pool.size()];
+                if (crewHours[candidate - 1] < crewHourLimit &&
+                    std::find(f.crewIDs.begin(), f.crewIDs.end(), candidate) == f.crewIDs.end()) id = candidate;
+            }
+            if (id == 0) id = hire(role);
+            crewHours[id - 1] += hours;
+            f.crewIDs.push_back(id);
+        };
+        for (long i = 0; i < std::max(12L, flightsPerDay); i++) hire(i % 3 == 0 ? "Pilot" : "Attendant");
+
+        // ------ Flights ------ //
+        std::vector<int> airportWeights;
+        for (const auto& a : airports) airportWeights.push_back(a.weight);
+        std::discrete_distribution<int> pickAirport(airportWeights.begin(), airportWeights.end());
+        auto pickHour = weighted(departureHourWeights);
+
+        std::vector<FlightRecord> flights(opt.flights);
+        std::vector<int> flightCapacity(opt.flights);
+        std::vector<double> flightKm(opt.flights);
+        for (long i = 0; i < opt.flights; i++) {
+            int from = pickAirport(rng), to;
+            do { to = pickAirport(rng); } while (to == from);
+            double km = distanceKm(airports[from], airports[to]);
+
+            // a random type, moved up to the next type with the range (wide bodies for long haul)
+            int type = pickType(rng);
+            while (fleetTypes[type].maxRangeKm < km && type < typeCount - 1) type++;
+            const std::vector<long>& candidates = fleetByType[type];
+            long aircraft = candidates[rng() % candidates.size()];
+
+            FlightRecord& f = flights[i];
+            f.flightNumber = static_cast<int>(100 + i);
+            f.origin = airports[from].city;
+            f.destination = airports[to].city;
+            f.aircraftModel = fleet[aircraft].model;
+            long minutes = static_cast<long>(rng() % opt.days) * 24 * 60 + pickHour(rng) * 60 + static_cast<long>(rng() % 12) * 5;
+            f.departureTime = start + std::chrono::minutes(minutes);
+            long blockMinutes = 30 + static_cast<long>(km / 800.0 * 60.0);
+            f.arrivalTime = f.departureTime + std::chrono::minutes(blockMinutes - blockMinutes % 5);
+            double roll = unit(rng);
+            f.status = roll < 0.85 ? FlightStatus::scheduled : roll < 0.95 ? FlightStatus::onTime
+                     : roll < 0.99 ? FlightStatus::delayed : FlightStatus::canceled;
+
+            // requiredPilots(): one pilot per started 5 hours, plus one cabin crew per 50 seats.
+            // Hours as Flight::getFlightHours() will see them after the times round-trip through the file.
+            auto stored = [](const timeType& t) { return parseDate(formatDateTime(t)); };
+            int flightHours = static_cast<int>(std::chrono::duration_cast<std::chrono::hours>(
+                stored(f.arrivalTime) - stored(f.departureTime)).count());
+            int pilotCount = std::max(1, (flightHours + 4) / 5);
+            int cabinCount = std::max(1, fleetTypes[type].capacity / 50);
+            for (int p = 0; p < pilotCount; p++) assignCrew(f, pilots, "Pilot", flightHours);
+            for (int a = 0; a < cabinCount; a++) assignCrew(f, cabin, "Attendant", flightHours);
+            flightCapacity[i] = fleetTypes[type].capacity;
+            flightKm[i] = km;
+        }
+
+        // ------ Users: passengers 1..N, then one agent per 10000 passengers and two admins ------ //
+        JsonArrayWriter users(dir + "Users.json");
+        for (long i = 1; i <= opt.passengers; i++) {
+            UserRecord u;
+            u.id = static_cast<int>(i);
+            u.name = std::string(firstNames[rng() % 20]) + " " + lastNames[rng() % 16];
+            u.email = "passenger" + std::to_string(i) + "@example.com";
+            u.password = std::to_string(100000 + rng() % 900000);
+            u.role = Role::passenger;
+            users.add(toJson(u));
+        }
+        const long agents = 1 + opt.passengers / 10000;
+        for (long i = 1; i <= agents + 2; i++) {
+            UserRecord u;
+            u.id = static_cast<int>(opt.passengers + i);
+            bool admin = i > agents;
+            u.name = (admin ? "Admin " : "Agent ") + std::to_string(i);
+            u.email = (admin ? "admin" : "agent") + std::to_string(i) + "@example.com";
+            u.password = "changeme";
+            u.role = admin ? Role::admin : Role::agent;
+            users.add(toJson(u));
+        }
+        long userRows = users.close();
+
+        // ------ Reservations: per-flight load around --load, distinct seats, skewed towards frequent flyers ------ //
+        std::normal_distribution<double> loadFactor(opt.load, 0.12);
+        auto pickMethod = weighted(paymentWeights);
+        JsonArrayWriter reservations(dir + "Reservations.json");
+        std::vector<int> seats;
+        int nextReservation = 1;
+        for (long i = 0; i < opt.flights; i++) {
+            if (flights[i].status == FlightStatus::canceled) continue;
+            const int capacity = flightCapacity[i];
+            int booked = static_cast<int>(std::lround(std::clamp(loadFactor(rng), 0.0, 1.0) * capacity));
+
+            seats.resize(capacity);
+            std::iota(seats.begin(), seats.end(), 1);
+            const int basePrice = 40 + static_cast<int>(flightKm[i] * 0.09);
+            for (int s = 0; s < booked; s++) {
+                std::swap(seats[s], seats[s + rng() % (capacity - s)]);    // partial Fisher-Yates: distinct seats
+
+                ReservationRecord r;
+                r.reservationId = nextReservation++;
+                double u = unit(rng);
+                r.passengerId = 1 + static_cast<int>(std::min(opt.passengers - 1, static_cast<long>(opt.passengers * u * u)));
+                r.flightNumber = flights[i].flightNumber;
+                r.seatNumber = seats[s];
+                r.checkIn = (flights[i].status == FlightStatus::onTime && unit(rng) < 0.6) ? "checked In" : "not yet";
+                r.method = paymentMethods[pickMethod(rng)];
+                r.details = r.method == "Cash" ? "paid at counter" : "card ending " + std::to_string(1000 + rng() % 9000);
+                r.amount = basePrice + static_cast<int>(rng() % static_cast<unsigned>(basePrice / 2 + 1));
+                reservations.add(toJson(r));
+            }
+        }
+        long reservationRows = reservations.close();
+
+        // ------ The small tables last, they are already in memory ------ //
+        JsonArrayWriter aircraftOut(dir + "Aircrafts.json");
+        for (const auto& a : fleet) aircraftOut.add(toJson(a));
+        aircraftOut.close();
+        JsonArrayWriter crewOut(dir + "Crew.json");
+        for (const auto& c : crew) crewOut.add(toJson(c));
+        crewOut.close();
+        JsonArrayWriter flightsOut(dir + "Flights.json");
+        for (const auto& f : flights) flightsOut.add(toJson(f));
+        flightsOut.close();
+
+        std::cout << "Wrote " << opt.out << ": " << fleetSize << " aircraft, " << crew.size() << " crew, " << userRows
+                  << " users, " << opt.flights << " flights, " << reservationRows << " reservations (seed " << opt.seed << ")\n";
+    } catch (const std::exception& e) {
+        std::cerr << "DataGen failed: " << e.what() << "\n";
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,195 @@
+// Load generator for the booking server (AirlineReservationSystem --serve).
+// Build with:  make tools      Start the server first, then run:
+//     LoadGen <origin> <YYYY-MM-DD> <passengerId> [clients=8] [seconds=5] [port=7070]
+// Every client holds one connection and loops over a mixed workload: 60% SEARCH from <origin> on
+// <date>, 20% BOOK (any seat) on a flight the search returned, 20% CANCEL of one of its own bookings
+// (a client holds at most 4 bookings).
+// Bookings still held at the end are cancelled, so the seat inventory is left as it was found.
+// Prints throughput and per-command p50 / p95 / p99 latency. Linux only, like serve mode.
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if defined(__linux__)
+    #include <arpa/inet.h>
+    #include <netinet/in.h>
+    #include <netinet/tcp.h>
+    #include <sys/socket.h>
+    #include <unistd.h>
+#endif
+
+namespace {
+    using Clock = std::chrono::steady_clock;
+
+    enum Command { searchCmd, bookCmd, cancelCmd, commandCount };
+    const std::size_t maxHeld = 4;      // a client cancels instead of booking past this, so the flights never fill up
+    const char* commandNames[] = {"SEARCH", "BOOK", "CANCEL"};
+
+    struct ClientStats {
+        std::vector<double> latencyUs[commandCount];
+        long errors = 0;            // ERR answers (e.g. flight full), not transport failures
+        bool failed = false;        // connection lost
+    };
+
+#if defined(__linux__)
+    // ------ Blocking line client, one request in flight ------ //
+    class LineClient {
+    private:
+        int fd = -1;
+        std::string buffer;
+
+    public:
+        explicit LineClient(int port) {
+            fd = socket(AF_INET, SOCK_STREAM, 0);
+            sockaddr_in addr{};
+            addr.sin_family = AF_INET;
+            addr.sin_port = htons(static_cast<uint16_t>(port));
+            addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+            if (fd < 0 || connect(fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) < 0) {
+                if (fd >= 0) close(fd);
+                fd = -1;
+                return;
+            }
+            int yes = 1;
+            setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &yes, sizeof(yes));
+        }
+        ~LineClient() { if (fd >= 0) close(fd); }
+
+        bool connected() const { return fd >= 0; }
+
+        // Sends one request line and waits for its response line; false if the connection broke
+        bool request(const std::string& line, std::string& response) {
+            std::string out = line + "\n";
+            for (std::size_t sent = 0; sent < out.size();) {
+                ssize_t n = send(fd, out.data() + sent, out.size() - sent, MSG_NOSIGNAL);
+                if (n <= 0) return false;
+                sent += static_cast<std::size_t>(n);
+            }
+            std::size_t end;
+            while ((end = buffer.find('\n')) == std::string::npos) {
+                char chunk[4096];
+                ssize_t n = recv(fd, chunk, sizeof(chunk), 0);
+                if (n <= 0) return false;
+                buffer.append(chunk, static_cast<std::size_t>(n));
+            }
+            response = buffer.substr(0, end);
+            buffer.erase(0, end + 1);
+            return true;
+        }
+    };
+
+    // ------ "OK <n> <flight>:<seatsLeft> ..." -> flights that still have seats ------ //
+    std::vector<int> openFlights(const std::string& response) {
+        std::vector<int> flights;
+        std::istringstream in(response);
+        std::string ok, entry;
+        int count;
+        if (!(in >> ok >> count) || ok != "OK") return flights;
+        while (in >> entry) {
+            std::size_t colon = entry.find(':');
+            if (colon != std::string::npos && std::stoi(entry.substr(colon + 1)) > 0)
+                flights.push_back(std::stoi(entry.substr(0, colon)));
+        }
+        return flights;
+    }
+
+    void runClient(int id, int port, const std::string& search, int passengerId, Clock::time_point until, ClientStats& stats) {
+        LineClient client(port);
+        if (!client.connected()) {
+            stats.failed = true;
+            return;
+        }
+        std::mt19937 rng(1234u + static_cast<unsigned>(id));
+        std::vector<int> flights, held;
+        std::string response;
+
+        auto timed = [&](Command cmd, const std::string& line) {
+            Clock::time_point start = Clock::now();
+            if (!client.request(line, response)) {
+                stats.failed = true;
+                return false;
+            }
+            stats.latencyUs[cmd].push_back(std::chrono::duration<double, std::micro>(Clock::now() - start).count());
+            if (response.compare(0, 2, "OK") != 0) stats.errors++;
+            return true;
+        };
+
+        while (Clock::now() < until && !stats.failed) {
+            int roll = static_cast<int>(rng() % 10);
+            if (roll < 6 || flights.empty()) {
+                if (timed(searchCmd, search)) flights = openFlights(response);
+            } else if ((roll < 8 && held.size() < maxHeld) || held.empty()) {
+                int flight = flights[rng() % flights.size()];
+                std::string line = "BOOK " + std::to_string(passengerId) + " " + std::to_string(flight) + " 0 100 Cash";
+                if (timed(bookCmd, line) && response.compare(0, 3, "OK ") == 0)
+                    held.push_back(std::stoi(response.substr(3)));
+            } else {
+                std::size_t pick = rng() % held.size();
+                timed(cancelCmd, "CANCEL " + std::to_string(held[pick]));
+                held[pick] = held.back();
+                held.pop_back();
+            }
+        }
+        for (int resId : held) client.request("CANCEL " + std::to_string(resId), response);
+        client.request("QUIT", response);
+    }
+#endif
+
+    double percentile(const std::vector<double>& sorted, double p) {
+        if (sorted.empty()) return 0.0;
+        std::size_t index = static_cast<std::size_t>(p * static_cast<double>(sorted.size() - 1) + 0.5);
+        return sorted[index];
+    }
+}
+
+int main(int argc, char** argv) {
+    if (argc < 4) {
+        std::cerr << "usage: LoadGen <origin> <YYYY-MM-DD> <passengerId> [clients=8] [seconds=5] [port=7070]\n";
+        return 2;
+    }
+#if defined(__linux__)
+    const std::string search = std::string("SEARCH ") + argv[1] + " * " + argv[2];
+    const int passengerId = std::stoi(argv[3]);
+    const int clients = argc > 4 ? std::stoi(argv[4]) : 8;
+    const int seconds = argc > 5 ? std::stoi(argv[5]) : 5;
+    const int port = argc > 6 ? std::stoi(argv[6]) : 7070;
+
+    std::vector<ClientStats> stats(clients);
+    std::vector<std::thread> threads;
+    Clock::time_point start = Clock::now();
+    Clock::time_point until = start + std::chrono::seconds(seconds);
+    for (int i = 0; i < clients; i++)
+        threads.emplace_back(runClient, i, port, std::cref(search), passengerId, until, std::ref(stats[i]));
+    for (auto& t : threads) t.join();
+    double elapsed = std::chrono::duration<double>(Clock::now() - start).count();
+
+    long total = 0, errors = 0;
+    int failed = 0;
+    std::printf("%d clients, %.1f s against 127.0.0.1:%d\n", clients, elapsed, port);
+    std::printf("  %-7s %10s %10s %10s %10s\n", "command", "requests", "p50 us", "p95 us", "p99 us");
+    for (int cmd = 0; cmd < commandCount; cmd++) {
+        std::vector<double> all;
+        for (const auto& s : stats) all.insert(all.end(), s.latencyUs[cmd].begin(), s.latencyUs[cmd].end());
+        std::sort(all.begin(), all.end());
+        total += static_cast<long>(all.size());
+        std::printf("  %-7s %10zu %10.1f %10.1f %10.1f\n", commandNames[cmd], all.size(),
+                    percentile(all, 0.50), percentile(all, 0.95), percentile(all, 0.99));
+    }
+    for (const auto& s : stats) {
+        errors += s.errors;
+        if (s.failed) failed++;
+    }
+    std::printf("  throughput: %.0f requests/s, %ld ERR answers, %d clients lost their connection\n",
+                static_cast<double>(total) / elapsed, errors, failed);
+    return failed ? 1 : 0;
+#else
+    std::cerr << "LoadGen needs Linux, like the server's serve mode.\n";
+    return 1;
+#endif
+}
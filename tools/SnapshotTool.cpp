@@ -0,0 +1,59 @@
+// Converts the database between the JSON files and the binary snapshot read at startup.
+// Build with:  make tools      Run from the project directory (paths are relative to it):
+//     SnapshotTool tobin  [snapshot]   JSON files -> snapshot (run after editing the JSON by hand)
+//     SnapshotTool tojson [snapshot]   snapshot   -> JSON files
+//     SnapshotTool info   [snapshot]   header, section sizes and freshness
+#include "../Include/Snapshot.hpp"
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+
+namespace {
+    const char* sectionNames[] = {"aircraft", "crew", "users", "flights", "flightCrew", "reservations", "strings"};
+
+    void printInfo(const std::string& path) {
+        SnapshotView view(path);
+        const SnapshotHeader& h = view.header();
+        std::printf("%s: version %u\n", path.c_str(), h.version);
+        for (int i = 0; i < static_cast<int>(SnapshotSection::count); i++) {
+            std::printf("  %-13s %10llu records x %3u bytes at offset %llu\n", sectionNames[i],
+                        static_cast<unsigned long long>(h.sections[i].count), h.sections[i].recordSize,
+                        static_cast<unsigned long long>(h.sections[i].offset));
+        }
+        std::printf("  %s\n", view.isFresh() ? "up to date with the JSON files" : "STALE: JSON files changed since it was written");
+    }
+
+    int usage() {
+        std::cerr << "usage: SnapshotTool tobin|tojson|info [snapshot path, default " << defaultSnapshotPath << "]\n";
+        return 2;
+    }
+}
+
+int main(int argc, char** argv) {
+    if (argc < 2) return usage();
+    const std::string command = argv[1];
+    const std::string path = argc > 2 ? argv[2] : defaultSnapshotPath;
+
+    try {
+        if (command == "tobin") {
+            SnapshotData data = loadJsonDatabase();
+            writeSnapshot(path, data);
+            std::cout << "Wrote " << path << " (" << data.flights.size() << " flights, "
+                      << data.reservations.size() << " reservations)\n";
+        } else if (command == "tojson") {
+            SnapshotData data = SnapshotView(path).load();
+            saveJsonDatabase(data);
+            stampSnapshotSources(data);     // re-stamp so the snapshot matches the files just written
+            writeSnapshot(path, data);
+            std::cout << "Wrote JSON files from " << path << "\n";
+        } else if (command == "info") {
+            printInfo(path);
+        } else {
+            return usage();
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << "\n";
+        return 1;
+    }
+    return 0;
+}